@@ -0,0 +1,30 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/foldable.hpp>
+
+#include "benchmark.hpp"
+#include <array>
+#include <cstdlib>
+
+
+int main() {
+    using Array = <%= array %>;
+    Array xs{};
+    for (auto& x : xs)
+        x = std::rand() % 1000;
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            xs[iteration % <%= input_size %>] += 1;
+            result += boost::hana::sum(xs);
+        }
+    });
+
+    return result == 0;
+}
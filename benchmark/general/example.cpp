@@ -0,0 +1,10 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+// Compiles one of the examples of the documentation, whose Hana headers
+// are either included textually or imported as modules depending on the
+// compiler flags.
+#include "<%= example %>"
@@ -0,0 +1,12 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+// Includes one of the public headers, to measure the time needed to
+// preprocess and parse it on its own.
+#include <<%= header %>>
+
+
+int main() { }
@@ -0,0 +1,36 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/group.hpp>
+#include <boost/hana/homogeneous_tuple.hpp>
+#include <boost/hana/monoid.hpp>
+#include <boost/hana/ring.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+
+
+template <typename T>
+T random_value() { return static_cast<T>(std::rand() % 1000) / 1000; }
+
+int main() {
+    using T = <%= type %>;
+    auto xs = boost::hana::make<boost::hana::<%= datatype %>>(
+        <%= (1..input_size).map { "random_value<T>()" }.join(', ') %>
+    );
+    auto ys = boost::hana::make<boost::hana::<%= datatype %>>(
+        <%= (1..input_size).map { "random_value<T>()" }.join(', ') %>
+    );
+    auto acc = xs;
+
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration)
+            acc = acc * xs - ys + acc;
+    });
+
+    return acc == xs;
+}
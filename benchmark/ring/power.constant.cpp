@@ -0,0 +1,20 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/ring.hpp>
+
+#include "benchmark.hpp"
+
+
+int main() {
+    boost::hana::benchmark::measure([] {
+        auto result = boost::hana::power(
+            boost::hana::ullong<1>, boost::hana::size_t< <%= input_size %> >
+        );
+        (void)result;
+    });
+}
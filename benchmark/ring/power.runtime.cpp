@@ -0,0 +1,24 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ring.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+
+
+int main() {
+    double result = 0;
+    int n = <%= input_size %>;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            double x = 1.0 + static_cast<double>(std::rand()) / RAND_MAX / n;
+            result += boost::hana::power(x, n);
+        }
+    });
+
+    return result == 0;
+}
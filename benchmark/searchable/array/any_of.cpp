@@ -0,0 +1,29 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/searchable.hpp>
+
+#include "benchmark.hpp"
+#include <array>
+#include <cstdlib>
+
+
+int main() {
+    using Array = <%= array %>;
+    Array xs{};
+    for (auto& x : xs)
+        x = std::rand() % (1 << 16);
+
+    int found = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration)
+            found += boost::hana::any_of(xs, boost::hana::equal.to(iteration));
+    });
+
+    return found == -1;
+}
@@ -0,0 +1,28 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/type.hpp>
+
+#include "benchmark.hpp"
+
+template <int i> struct x { };
+
+
+int main() {
+    auto map = boost::hana::make<boost::hana::Map>(
+        <%= (1..input_size).to_a.map { |i|
+            "boost::hana::make<boost::hana::Pair>(boost::hana::type<x<#{i}>>, x<#{i}>{})"
+        }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([=] {
+        <% (1..input_size).each do |i| %>
+            boost::hana::elem(map, boost::hana::type<x<<%= i %>>>);
+        <% end %>
+    });
+}
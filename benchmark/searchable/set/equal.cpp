@@ -0,0 +1,31 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/set.hpp>
+#include <boost/hana/type.hpp>
+
+#include "benchmark.hpp"
+
+template <int i> struct x { };
+
+
+int main() {
+    auto xs = boost::hana::make<boost::hana::Set>(
+        <%= (1..input_size).to_a.map { |i|
+            "boost::hana::type<x<#{i}>>"
+        }.join(', ') %>
+    );
+
+    auto ys = boost::hana::make<boost::hana::Set>(
+        <%= (1..input_size).to_a.reverse.map { |i|
+            "boost::hana::type<x<#{i}>>"
+        }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([=] {
+        boost::hana::equal(xs, ys);
+    });
+}
@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "benchmark.hpp"
+
+template <int i> struct x { };
+
+
+int main() {
+    // Each type appears twice, so half of the elements are duplicates.
+    auto xs = boost::hana::make<boost::hana::Tuple>(
+        <%= ((1..input_size).to_a * 2).map { |i|
+            "boost::hana::type<x<#{i}>>"
+        }.join(', ') %>
+    );
+
+    boost::hana::benchmark::measure([=] {
+        boost::hana::to<boost::hana::Set>(xs);
+    });
+}
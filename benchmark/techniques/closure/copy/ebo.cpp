@@ -0,0 +1,29 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/closure.hpp>
+
+#include "benchmark.hpp"
+#include <iostream>
+#include <vector>
+using boost::hana::detail::closure;
+
+
+template <int> struct tag { };
+
+using Closure = closure<
+    <%= (0...input_size).map { |n| n % 2 == 0 ? "tag<#{n}>" : "int" }.join(', ') %>
+>;
+
+int main() {
+    std::cerr << "sizeof: " << sizeof(Closure) << std::endl;
+
+    std::vector<Closure> closures(1 << 12);
+    boost::hana::benchmark::measure([&] {
+        std::vector<Closure> copy(closures);
+        closures.swap(copy);
+    });
+}
@@ -0,0 +1,51 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+
+#include "benchmark.hpp"
+#include <iostream>
+#include <vector>
+using namespace boost::hana::detail::std;
+
+
+// This is the closure layout used before empty elements were stored as
+// base classes; every element is held as a member, even when it is empty.
+template <size_t n, typename Xn>
+struct element { Xn get; };
+
+template <typename ...Xs>
+struct closure_impl : Xs... { };
+
+template <typename Indices, typename ...Xs>
+struct make_closure_impl;
+
+template <size_t ...n, typename ...Xn>
+struct make_closure_impl<index_sequence<n...>, Xn...> {
+    using type = closure_impl<element<n, Xn>...>;
+};
+
+template <typename ...Xs>
+using closure = typename make_closure_impl<
+    make_index_sequence<sizeof...(Xs)>, Xs...
+>::type;
+
+template <int> struct tag { };
+
+using Closure = closure<
+    <%= (0...input_size).map { |n| n % 2 == 0 ? "tag<#{n}>" : "int" }.join(', ') %>
+>;
+
+int main() {
+    std::cerr << "sizeof: " << sizeof(Closure) << std::endl;
+
+    std::vector<Closure> closures(1 << 12);
+    boost::hana::benchmark::measure([&] {
+        std::vector<Closure> copy(closures);
+        closures.swap(copy);
+    });
+}
@@ -0,0 +1,41 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+namespace bh = boost::hana;
+
+
+int main () {
+    long long result = 0;
+    auto kernel = [&](auto width, auto arity, auto mode) {
+        result += bh::value(width) * bh::value(arity) + bh::value(mode);
+    };
+
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            int width = 1 + std::rand() % <%= input_size %>;
+            int arity = std::rand() % 8;
+            int mode = std::rand() % 4;
+            bh::for_each(bh::range_c<int, 1, <%= input_size + 1 %>>, [&](auto w) {
+                if (bh::value(w) != width) return;
+                bh::for_each(bh::range_c<int, 0, 8>, [&](auto a) {
+                    if (bh::value(a) != arity) return;
+                    bh::for_each(bh::range_c<int, 0, 4>, [&](auto m) {
+                        if (bh::value(m) == mode)
+                            kernel(w, a, m);
+                    });
+                });
+            });
+        }
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,38 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+namespace bh = boost::hana;
+
+
+int main () {
+    long long result = 0;
+    auto kernel = [&](auto width, auto arity, auto mode) {
+        result += bh::value(width) * bh::value(arity) + bh::value(mode);
+    };
+
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            int width = 1 + std::rand() % <%= input_size %>;
+            int arity = std::rand() % 8;
+            int mode = std::rand() % 4;
+            bh::dispatch(
+                bh::make<bh::Tuple>(bh::range_c<int, 1, <%= input_size + 1 %>>,
+                                    bh::range_c<int, 0, 8>,
+                                    bh::range_c<int, 0, 4>),
+                bh::make<bh::Tuple>(width, arity, mode),
+                kernel
+            );
+        }
+    });
+
+    return result == 0;
+}
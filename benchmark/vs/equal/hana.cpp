@@ -0,0 +1,59 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+
+struct Key {
+    <% (0...input_size).each do |i| %>
+        int m<%= i %>;
+    <% end %>
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Key> {
+        static auto apply() {
+            return make<Tuple>(
+                <% (0...input_size).each do |i| %>
+                    <%= ',' if i > 0 %> make<Pair>(BOOST_HANA_STRING("m<%= i %>"),
+                        [](auto&& k) -> decltype(auto) {
+                            return id(std::forward<decltype(k)>(k).m<%= i %>);
+                        })
+                <% end %>
+            );
+        }
+    };
+}}
+
+int main () {
+    // Every other pair of keys differs in its last member only.
+    std::vector<Key> xs(1 << 12), ys(1 << 12);
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        xs[i] = Key{<%= (0...input_size).map { 'std::rand()' }.join(', ') %>};
+        ys[i] = xs[i];
+        ys[i].m<%= input_size - 1 %> += i % 2;
+    }
+
+    std::size_t result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i < xs.size(); ++i)
+            result += boost::hana::equal(xs[i], ys[i]);
+    });
+
+    return result == 0;
+}
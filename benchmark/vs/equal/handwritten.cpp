@@ -0,0 +1,39 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "benchmark.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+struct Key {
+    <% (0...input_size).each do |i| %>
+        int m<%= i %>;
+    <% end %>
+};
+
+bool equal(Key const& x, Key const& y) {
+    return <%= (0...input_size).map { |i| "x.m#{i} == y.m#{i}" }.join(' &&\n           ') %>;
+}
+
+int main () {
+    // Every other pair of keys differs in its last member only.
+    std::vector<Key> xs(1 << 12), ys(1 << 12);
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        xs[i] = Key{<%= (0...input_size).map { 'std::rand()' }.join(', ') %>};
+        ys[i] = xs[i];
+        ys[i].m<%= input_size - 1 %> += i % 2;
+    }
+
+    std::size_t result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i < xs.size(); ++i)
+            result += equal(xs[i], ys[i]);
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,55 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+
+struct Key {
+    <% types.each_with_index do |t, i| %>
+        <%= t %> m<%= i %>;
+    <% end %>
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Key> {
+        static auto apply() {
+            return make<Tuple>(
+                <% types.each_index do |i| %>
+                    <%= ',' if i > 0 %> make<Pair>(BOOST_HANA_STRING("m<%= i %>"),
+                        [](auto&& k) -> decltype(auto) {
+                            return id(std::forward<decltype(k)>(k).m<%= i %>);
+                        })
+                <% end %>
+            );
+        }
+    };
+}}
+
+int main () {
+    std::vector<Key> keys(1 << 12);
+    for (Key& key : keys)
+        key = Key{<%= types.map { |t| "static_cast<#{t}>(std::rand())" }.join(', ') %>};
+
+    std::size_t result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (Key const& key : keys)
+            result += boost::hana::hash(key);
+    });
+
+    return result == 0;
+}
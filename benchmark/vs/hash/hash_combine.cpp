@@ -0,0 +1,41 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/functional/hash.hpp>
+
+#include "benchmark.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+struct Key {
+    <% types.each_with_index do |t, i| %>
+        <%= t %> m<%= i %>;
+    <% end %>
+};
+
+std::size_t hash_value(Key const& key) {
+    std::size_t seed = 0;
+    <% types.each_index do |i| %>
+        boost::hash_combine(seed, key.m<%= i %>);
+    <% end %>
+    return seed;
+}
+
+int main () {
+    std::vector<Key> keys(1 << 12);
+    for (Key& key : keys)
+        key = Key{<%= types.map { |t| "static_cast<#{t}>(std::rand())" }.join(', ') %>};
+
+    std::size_t result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (Key const& key : keys)
+            result += hash_value(key);
+    });
+
+    return result == 0;
+}
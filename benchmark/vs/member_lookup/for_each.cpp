@@ -0,0 +1,73 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+
+// Whether a runtime string is equal to a compile-time String.
+template <char ...s>
+bool matches(boost::hana::_string<s...>, char const* query, std::size_t length) {
+    constexpr char name[] = {s..., '\0'};
+    return length == sizeof...(s) && std::memcmp(query, name, length) == 0;
+}
+
+struct Fields {
+    <% (1..input_size).each do |i| %>
+        int field_<%= i %>;
+    <% end %>
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Fields> {
+        static auto apply() {
+            return make<Tuple>(
+                <% (1..input_size).each do |i| %>
+                    <%= ',' if i > 1 %> make<Pair>(BOOST_HANA_STRING("field_<%= i %>"),
+                        [](auto&& f) -> decltype(auto) {
+                            return id(std::forward<decltype(f)>(f).field_<%= i %>);
+                        })
+                <% end %>
+            );
+        }
+    };
+}}
+
+int main () {
+    Fields fields{<%= (1..input_size).to_a.join(', ') %>};
+
+    // Every other query is a miss.
+    char const* queries[] = {
+        <%= (1..input_size).map { |i|
+            "\"field_#{i}\", \"field_#{i}_\""
+        }.join(', ') %>
+    };
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            char const* query = queries[std::rand() % (2 * <%= input_size %>)];
+            std::size_t length = std::strlen(query);
+            boost::hana::for_each(boost::hana::members<Fields>(), [&](auto member) {
+                if (matches(boost::hana::first(member), query, length))
+                    result += boost::hana::second(member)(fields);
+            });
+        }
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,41 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/packed_tuple.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+#include <vector>
+namespace bh = boost::hana;
+
+
+int main () {
+    // An event with padding between its members when they are stored in
+    // declaration order.
+    using Event = decltype(bh::make<bh::<%= datatype %>>(
+        char{}, double{}, char{}, double{}, bool{}
+    ));
+
+    std::vector<Event> events;
+    events.reserve(<%= input_size %>);
+    for (int i = 0; i < <%= input_size %>; ++i)
+        events.push_back(bh::make<bh::<%= datatype %>>(
+            static_cast<char>(i), i * 0.5, static_cast<char>(i % 7),
+            i * 0.25, i % 3 == 0
+        ));
+
+    double result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (auto const& event : events) {
+            bh::for_each(event, [&](auto x) {
+                result += x;
+            });
+        }
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,58 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/view.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+#include <iostream>
+namespace bh = boost::hana;
+
+
+long long copies = 0;
+
+template <int i>
+struct x {
+    long payload[8];
+    x() : payload{i} { }
+    x(x const& other) { ++copies; for (int k = 0; k < 8; ++k) payload[k] = other.payload[k]; }
+    x(x&& other) { ++copies; for (int k = 0; k < 8; ++k) payload[k] = other.payload[k]; }
+};
+
+struct keep_even {
+    template <int i>
+    constexpr auto operator()(x<i> const&) const
+    { return bh::bool_<i % 2 == 0>; }
+};
+
+int main () {
+    auto xs = bh::make<bh::Tuple>(
+        <%= (1..input_size).map { |i| "x<#{i}>{}" }.join(', ') %>
+    );
+    auto id = [](auto const& e) -> auto const& { return e; };
+
+    long long result = 0;
+    copies = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            // 4-stage pipeline, materialized once at the end.
+            auto ys = bh::to<bh::Tuple>(bh::sliced(
+                bh::reversed(bh::filtered(bh::transformed(xs, id), keep_even{})),
+                bh::int_<0>, bh::int_<<%= input_size / 4 %>>)
+            );
+            result += bh::unpack(ys, [](auto const& ...y) {
+                long sum = 0;
+                for (long p : {0l, y.payload[0]...}) sum += p;
+                return sum;
+            });
+        }
+    });
+
+    std::cerr << "copies: " << copies << std::endl;
+    return result == 0;
+}
@@ -0,0 +1,62 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/serialization.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <utility>
+#include <vector>
+
+
+struct Order {
+    long id;
+    int price;
+    int quantity;
+    double time;
+    char side;
+    std::vector<int> fills;
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Order> {
+        static auto apply() {
+            return make<Tuple>(
+                <% %w(id price quantity time side fills).each_with_index do |name, i| %>
+                    <%= ',' if i > 0 %> make<Pair>(BOOST_HANA_STRING("<%= name %>"),
+                        [](auto&& o) -> decltype(auto) {
+                            return id(std::forward<decltype(o)>(o).<%= name %>);
+                        })
+                <% end %>
+            );
+        }
+    };
+}}
+
+int main () {
+    std::vector<Order> orders;
+    for (int i = 0; i < <%= input_size %>; ++i)
+        orders.push_back(Order{i, i % 100, i % 7, i * 0.5, 'b', {i, i + 1}});
+
+    std::size_t size = 0;
+    for (auto const& order : orders)
+        size += boost::hana::serialized_size(order);
+    std::vector<char> buffer(size);
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        for (auto const& order : orders)
+            out = boost::hana::serialize(order, out);
+    });
+
+    return buffer[0] == 0;
+}
@@ -0,0 +1,60 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "benchmark.hpp"
+#include <cstring>
+#include <vector>
+
+
+struct Order {
+    long id;
+    int price;
+    int quantity;
+    double time;
+    char side;
+    std::vector<int> fills;
+};
+
+template <typename T>
+char* write(T const& x, char* out) {
+    std::memcpy(out, &x, sizeof(x));
+    return out + sizeof(x);
+}
+
+std::size_t serialized_size(Order const& order) {
+    return sizeof(long) + 2 * sizeof(int) + sizeof(double) + sizeof(char) +
+           sizeof(unsigned long long) + order.fills.size() * sizeof(int);
+}
+
+char* serialize(Order const& order, char* out) {
+    out = write(order.id, out);
+    out = write(order.price, out);
+    out = write(order.quantity, out);
+    out = write(order.time, out);
+    out = write(order.side, out);
+    out = write(static_cast<unsigned long long>(order.fills.size()), out);
+    std::memcpy(out, order.fills.data(), order.fills.size() * sizeof(int));
+    return out + order.fills.size() * sizeof(int);
+}
+
+int main () {
+    std::vector<Order> orders;
+    for (int i = 0; i < <%= input_size %>; ++i)
+        orders.push_back(Order{i, i % 100, i % 7, i * 0.5, 'b', {i, i + 1}});
+
+    std::size_t size = 0;
+    for (auto const& order : orders)
+        size += serialized_size(order);
+    std::vector<char> buffer(size);
+
+    boost::hana::benchmark::measure([&] {
+        char* out = buffer.data();
+        for (auto const& order : orders)
+            out = serialize(order, out);
+    });
+
+    return buffer[0] == 0;
+}
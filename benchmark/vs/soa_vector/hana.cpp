@@ -0,0 +1,65 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+
+// A record with 20 members, of which only two are read.
+struct Trade {
+    double price;
+    double quantity;
+    <% (2...20).each do |i| %>
+        double f<%= i %>;
+    <% end %>
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Trade> {
+        static auto apply() {
+            return make<Tuple>(
+                <% (['price', 'quantity'] + (2...20).map { |i| "f#{i}" }).each_with_index do |name, i| %>
+                    <%= ',' if i > 0 %> make<Pair>(BOOST_HANA_STRING("<%= name %>"),
+                        [](auto&& t) -> decltype(auto) {
+                            return id(std::forward<decltype(t)>(t).<%= name %>);
+                        })
+                <% end %>
+            );
+        }
+    };
+}}
+
+int main () {
+    boost::hana::soa_vector<Trade> trades;
+    trades.reserve(<%= input_size %>);
+    for (int i = 0; i < <%= input_size %>; ++i) {
+        Trade trade{};
+        trade.price = i * 0.5;
+        trade.quantity = i % 10;
+        trades.push_back(trade);
+    }
+
+    auto const& prices = trades[BOOST_HANA_STRING("price")];
+    auto const& quantities = trades[BOOST_HANA_STRING("quantity")];
+
+    double result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (std::size_t i = 0; i < prices.size(); ++i)
+            result += prices[i] * quantities[i];
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,37 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "benchmark.hpp"
+#include <vector>
+
+
+// A record with 20 members, of which only two are read.
+struct Trade {
+    double price;
+    double quantity;
+    <% (2...20).each do |i| %>
+        double f<%= i %>;
+    <% end %>
+};
+
+int main () {
+    std::vector<Trade> trades;
+    trades.reserve(<%= input_size %>);
+    for (int i = 0; i < <%= input_size %>; ++i) {
+        Trade trade{};
+        trade.price = i * 0.5;
+        trade.quantity = i % 10;
+        trades.push_back(trade);
+    }
+
+    double result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (auto const& trade : trades)
+            result += trade.price * trade.quantity;
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,44 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+
+using Tuple = boost::hana::_tuple<<%= (['int'] * input_size).join(', ') %>>;
+
+// The generic lexicographical comparison of Sequences, which compares
+// the elements with both `less` and `equal`.
+struct less_t {
+    bool operator()(Tuple const& xs, Tuple const& ys) const {
+        using Tpl = boost::hana::Tuple;
+        return boost::hana::Sequence::less_impl<Tpl, Tpl>::apply(xs, ys);
+    }
+};
+
+int main () {
+    // Few distinct values, so that many tuples share a prefix.
+    std::vector<Tuple> input(10000000);
+    for (std::size_t i = 0; i < input.size(); ++i)
+        input[i] = boost::hana::make<boost::hana::Tuple>(
+            <%= (['std::rand() % 4'] * input_size).join(', ') %>
+        );
+
+    less_t less;
+    std::vector<Tuple> xs;
+    boost::hana::benchmark::measure([&] {
+        xs = input;
+        std::sort(xs.begin(), xs.end(), less);
+    });
+
+    return !std::is_sorted(xs.begin(), xs.end(), less);
+}
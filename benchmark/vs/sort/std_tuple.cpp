@@ -0,0 +1,32 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "benchmark.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+
+
+using Tuple = std::tuple<<%= (['int'] * input_size).join(', ') %>>;
+
+int main () {
+    // Few distinct values, so that many tuples share a prefix.
+    std::vector<Tuple> input(10000000);
+    for (std::size_t i = 0; i < input.size(); ++i)
+        input[i] = std::make_tuple(
+            <%= (['std::rand() % 4'] * input_size).join(', ') %>
+        );
+
+    std::vector<Tuple> xs;
+    boost::hana::benchmark::measure([&] {
+        xs = input;
+        std::sort(xs.begin(), xs.end());
+    });
+
+    return !std::is_sorted(xs.begin(), xs.end());
+}
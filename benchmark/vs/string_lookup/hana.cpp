@@ -0,0 +1,42 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+#include <cstring>
+namespace bh = boost::hana;
+
+
+int main () {
+    auto table = bh::frozen_lookup(bh::make<bh::Map>(
+        <%= (1..input_size).map { |i|
+            "bh::make<bh::Pair>(BOOST_HANA_STRING(\"field_#{i}\"), #{i})"
+        }.join(', ') %>
+    ));
+
+    // Every other query is a miss.
+    char const* queries[] = {
+        <%= (1..input_size).map { |i|
+            "\"field_#{i}\", \"field_#{i}_\""
+        }.join(', ') %>
+    };
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            char const* query = queries[std::rand() % (2 * <%= input_size %>)];
+            table(query, std::strlen(query), [&](int value) {
+                result += value;
+            });
+        }
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,34 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "benchmark.hpp"
+#include <cstdlib>
+#include <cstring>
+
+
+int main () {
+    // Every other query is a miss.
+    char const* queries[] = {
+        <%= (1..input_size).map { |i|
+            "\"field_#{i}\", \"field_#{i}_\""
+        }.join(', ') %>
+    };
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            char const* query = queries[std::rand() % (2 * <%= input_size %>)];
+            std::size_t length = std::strlen(query);
+            <% (1..input_size).each do |i| %>
+                <%= i == 1 ? "" : "else " %>if (length == sizeof("field_<%= i %>") - 1 &&
+                    std::memcmp(query, "field_<%= i %>", length) == 0)
+                    result += <%= i %>;
+            <% end %>
+        }
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,37 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "benchmark.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+
+int main () {
+    std::unordered_map<std::string, int> table{
+        <%= (1..input_size).map { |i| "{\"field_#{i}\", #{i}}" }.join(', ') %>
+    };
+
+    // Every other query is a miss.
+    char const* queries[] = {
+        <%= (1..input_size).map { |i|
+            "\"field_#{i}\", \"field_#{i}_\""
+        }.join(', ') %>
+    };
+
+    long long result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            char const* query = queries[std::rand() % (2 * <%= input_size %>)];
+            auto it = table.find(std::string(query, std::strlen(query)));
+            if (it != table.end())
+                result += it->second;
+        }
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,33 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+namespace bh = boost::hana;
+
+
+int main () {
+    auto xs = bh::make<bh::Tuple>(
+        <%= (1..input_size).map { |i|
+            ["static_cast<int>(#{i})", "static_cast<long>(#{i})",
+             "static_cast<double>(#{i})"][i % 3]
+        }.join(', ') %>
+    );
+
+    long double result = 0;
+    boost::hana::benchmark::measure([&] {
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::size_t i = std::rand() % <%= input_size %>;
+            bh::visit_at(i, xs, [&](auto x) {
+                result += x;
+            });
+        }
+    });
+
+    return result == 0;
+}
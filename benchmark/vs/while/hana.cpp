@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/logical.hpp>
+
+#include "benchmark.hpp"
+#include <cstdlib>
+namespace bh = boost::hana;
+
+
+int main () {
+    long long result = 0;
+    long long const n = <%= input_size %> + std::rand() % 2;
+
+    boost::hana::benchmark::measure([&] {
+        result += bh::while_([=](long long i) { return i < n; }, 0ll,
+                             [](long long i) { return i + 1; });
+        result += bh::until([=](long long i) { return i == n; }, 0ll,
+                            [](long long i) { return i + 1; });
+    });
+
+    return result == 0;
+}
@@ -0,0 +1,28 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include "benchmark.hpp"
+#include <cstdlib>
+
+
+int main () {
+    long long result = 0;
+    long long const n = <%= input_size %> + std::rand() % 2;
+
+    boost::hana::benchmark::measure([&] {
+        long long i = 0;
+        while (i < n)
+            i = i + 1;
+        result += i;
+
+        long long j = 0;
+        while (!(j == n))
+            j = j + 1;
+        result += j;
+    });
+
+    return result == 0;
+}
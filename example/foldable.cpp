@@ -64,6 +64,36 @@ BOOST_HANA_RUNTIME_CHECK(
 
 }{
 
+//! [tree_fold]
+auto to_string = [](auto x) {
+    std::ostringstream ss;
+    ss << x;
+    return ss.str();
+};
+
+// string concatenation is associative, so tree_fold and foldl1 agree
+auto append = [=](auto x, auto y) {
+    return to_string(x) + to_string(y);
+};
+
+BOOST_HANA_RUNTIME_CHECK(
+    tree_fold(make<Tuple>("1", 2, '3', 4, 5.0), append) == "12345"
+);
+
+// but the elements are grouped as a balanced tree
+auto f = [=](auto x, auto y) {
+    return "f(" + to_string(x) + ", " + to_string(y) + ")";
+};
+
+BOOST_HANA_RUNTIME_CHECK(
+    tree_fold(make<Tuple>("1", 2, '3', 4, 5.0), f)
+        ==
+    "f(f(f(1, 2), f(3, 4)), 5)"
+);
+//! [tree_fold]
+
+}{
+
 //! [foldr]
 auto to_string = [](auto x) {
     std::ostringstream ss;
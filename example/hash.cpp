@@ -0,0 +1,66 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/hash.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+using namespace boost::hana;
+
+
+struct Instrument {
+    std::string symbol;
+    int exchange;
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Instrument> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply() {
+            return make<Tuple>(
+                make<Pair>(BOOST_HANA_STRING("symbol"), [](auto&& i) -> decltype(auto) {
+                    return id(std::forward<decltype(i)>(i).symbol);
+                }),
+                make<Pair>(BOOST_HANA_STRING("exchange"), [](auto&& i) -> decltype(auto) {
+                    return id(std::forward<decltype(i)>(i).exchange);
+                })
+            );
+        }
+    };
+}}
+
+int main() {
+    // Records can be used as keys without writing a hash function
+    using Hash = std::decay_t<decltype(hash)>;
+    using Equal = std::decay_t<decltype(equal)>;
+    std::unordered_map<Instrument, double, Hash, Equal> prices;
+    prices[Instrument{"ABC", 1}] = 10.5;
+    prices[Instrument{"ABC", 2}] = 10.25;
+    BOOST_HANA_RUNTIME_CHECK(prices.size() == 2);
+    BOOST_HANA_RUNTIME_CHECK(prices.at(Instrument{"ABC", 2}) == 10.25);
+
+    // So can Tuples
+    std::unordered_map<_tuple<int, int>, int, Hash, Equal> grid;
+    grid[make<Tuple>(1, 2)] = 3;
+    BOOST_HANA_RUNTIME_CHECK(grid.count(make<Tuple>(2, 1)) == 0);
+
+    // The hash value of a compile-time String is computed at compile-time
+    auto abc = BOOST_HANA_STRING("ABC");
+    constexpr std::size_t h = decltype(hash(abc))::value;
+    static_assert(h == hash(abc), "");
+}
@@ -0,0 +1,143 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/homogeneous_tuple.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [make<HomogeneousTuple>]
+constexpr auto xs = make<HomogeneousTuple>(1, 2, 3, 4);
+BOOST_HANA_CONSTANT_CHECK(length(xs) == size_t<4>);
+static_assert(sizeof(xs) == 4 * sizeof(int), "");
+
+// make<HomogeneousTuple>(1, 2.0) would not compile
+//! [make<HomogeneousTuple>]
+
+}{
+
+//! [empty_homogeneous_tuple]
+constexpr auto xs = empty_homogeneous_tuple<int>;
+BOOST_HANA_CONSTANT_CHECK(is_empty(xs));
+BOOST_HANA_CONSTANT_CHECK(length(xs) == size_t<0>);
+//! [empty_homogeneous_tuple]
+
+}{
+
+//! [comparable]
+BOOST_HANA_CONSTEXPR_CHECK(homogeneous_tuple(1, 2, 3) == homogeneous_tuple(1, 2, 3));
+BOOST_HANA_CONSTEXPR_CHECK(homogeneous_tuple(1, 2, 3) != homogeneous_tuple(1, 2, 4));
+
+// homogeneous tuples of different lengths are never equal
+BOOST_HANA_CONSTANT_CHECK(homogeneous_tuple(1, 2, 3) != homogeneous_tuple(1, 2));
+//! [comparable]
+
+}{
+
+//! [orderable]
+BOOST_HANA_CONSTEXPR_CHECK(homogeneous_tuple(1, 2, 3) < homogeneous_tuple(1, 2, 4));
+BOOST_HANA_CONSTEXPR_CHECK(homogeneous_tuple(1, 2) < homogeneous_tuple(1, 2, 3));
+BOOST_HANA_CONSTEXPR_CHECK(homogeneous_tuple(2, 0, 0) > homogeneous_tuple(1, 9));
+//! [orderable]
+
+}{
+
+//! [functor]
+BOOST_HANA_RUNTIME_CHECK(
+    transform(homogeneous_tuple(1, 2, 3), [](int i) {
+        return std::to_string(i);
+    })
+    ==
+    homogeneous_tuple(std::string{"1"}, std::string{"2"}, std::string{"3"})
+);
+//! [functor]
+
+}{
+
+//! [foldable]
+BOOST_HANA_CONSTEXPR_CHECK(sum(homogeneous_tuple(1, 2, 3, 4)) == 10);
+BOOST_HANA_CONSTEXPR_CHECK(maximum(homogeneous_tuple(1, 5, 3, 4)) == 5);
+
+// the first call to the function returns a new type of state, but every
+// other call is done in a loop
+BOOST_HANA_RUNTIME_CHECK(
+    foldl(homogeneous_tuple(1, 2, 3), type<void>, [](auto, int i) {
+        return static_cast<long>(i);
+    }) == 3l
+);
+//! [foldable]
+
+}{
+
+//! [iterable]
+constexpr auto xs = homogeneous_tuple(1, 2, 3, 4);
+BOOST_HANA_CONSTEXPR_CHECK(head(xs) == 1);
+BOOST_HANA_CONSTEXPR_CHECK(last(xs) == 4);
+BOOST_HANA_CONSTEXPR_CHECK(tail(xs) == homogeneous_tuple(2, 3, 4));
+BOOST_HANA_CONSTANT_CHECK(!is_empty(xs));
+BOOST_HANA_CONSTANT_CHECK(is_empty(drop(size_t<4>, xs)));
+
+for (int i = 0; i != 4; ++i)
+    BOOST_HANA_RUNTIME_CHECK(xs[i] == i + 1);
+//! [iterable]
+
+}{
+
+//! [searchable]
+BOOST_HANA_CONSTEXPR_CHECK(any_of(homogeneous_tuple(1, 2, 3), [](int i) {
+    return i == 2;
+}));
+
+BOOST_HANA_CONSTEXPR_CHECK(
+    find_if(homogeneous_tuple(1, 2, 3), [](auto x) {
+        return equal(decltype_(x), type<int>);
+    }) == just(1)
+);
+//! [searchable]
+
+}{
+
+//! [arithmetic]
+BOOST_HANA_CONSTEXPR_CHECK(
+    homogeneous_tuple(1.0, 2.0, 3.0, 4.0) + homogeneous_tuple(0.5, 0.5, 0.5, 0.5)
+        ==
+    homogeneous_tuple(1.5, 2.5, 3.5, 4.5)
+);
+
+BOOST_HANA_CONSTEXPR_CHECK(
+    homogeneous_tuple(1, 2, 3) * homogeneous_tuple(4, 5, 6) - homogeneous_tuple(1, 1, 1)
+        ==
+    homogeneous_tuple(3, 9, 17)
+);
+
+BOOST_HANA_CONSTEXPR_CHECK(-homogeneous_tuple(1, -2) == homogeneous_tuple(-1, 2));
+//! [arithmetic]
+
+}{
+
+//! [conversions]
+BOOST_HANA_CONSTEXPR_CHECK(
+    to<Tuple>(homogeneous_tuple(1, 2, 3)) == make<Tuple>(1, 2, 3)
+);
+
+BOOST_HANA_CONSTEXPR_CHECK(
+    to<HomogeneousTuple>(make<Tuple>(1, 2, 3)) == homogeneous_tuple(1, 2, 3)
+);
+//! [conversions]
+
+}
+
+}
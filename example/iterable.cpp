@@ -9,12 +9,15 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/maybe.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/range.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
 
 #include <sstream>
+#include <string>
 #include <type_traits>
+#include <utility>
 using namespace boost::hana;
 
 
@@ -44,6 +47,25 @@ BOOST_HANA_CONSTEXPR_CHECK(at_c<2>(make<Tuple>(0, '1', 2.0)) == 2.0);
 
 }{
 
+//! [visit_at]
+auto xs = make<Tuple>(0, '1', 2.0);
+std::ostringstream ss;
+auto print = [&](auto const& x) { ss << x; };
+
+BOOST_HANA_RUNTIME_CHECK(visit_at(1, xs, print));
+BOOST_HANA_RUNTIME_CHECK(visit_at(2, xs, print));
+BOOST_HANA_RUNTIME_CHECK(!visit_at(3, xs, print));
+BOOST_HANA_RUNTIME_CHECK(ss.str() == "12");
+
+// With a built-in integer, `operator[]` also selects the element at runtime.
+auto ys = make<Tuple>(10, 20, 30);
+int i = 2;
+ys[i] += 5;
+BOOST_HANA_RUNTIME_CHECK(ys[i] == 35);
+//! [visit_at]
+
+}{
+
 //! [drop]
 constexpr auto xs = make<Tuple>(0, '1', 2.0);
 BOOST_HANA_CONSTEXPR_CHECK(drop(int_<0>, xs) == xs);
@@ -116,6 +138,20 @@ BOOST_HANA_CONSTEXPR_CHECK(
 
 }{
 
+//! [uncons]
+BOOST_HANA_CONSTEXPR_CHECK(
+    uncons(make<Tuple>(1, '2', 3.3)) == pair(1, make<Tuple>('2', 3.3))
+);
+
+// The elements of an rvalue are moved into the result instead of being copied.
+auto xs = make<Tuple>(std::string{"abc"}, std::string{"def"});
+auto ys = uncons(std::move(xs));
+BOOST_HANA_RUNTIME_CHECK(first(ys) == "abc");
+BOOST_HANA_RUNTIME_CHECK(second(ys) == make<Tuple>(std::string{"def"}));
+//! [uncons]
+
+}{
+
 //! [Searchable]
 BOOST_HANA_CONSTEXPR_CHECK(
     find_if(make<Tuple>(1.0, 2, '3'), trait_<std::is_integral>) == just(2)
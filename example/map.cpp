@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/map.hpp>
 #include <boost/hana/maybe.hpp>
 #include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/type.hpp>
 
 #include <string>
@@ -76,6 +77,23 @@ BOOST_HANA_CONSTANT_CHECK(find(m, type<void>) == nothing);
 BOOST_HANA_CONSTANT_CHECK(find(m, int_<3>) == nothing);
 //! [searchable]
 
+}{
+
+//! [frozen_lookup]
+auto handlers = frozen_lookup(make_map(
+    pair(BOOST_HANA_STRING("width"), 1),
+    pair(BOOST_HANA_STRING("height"), 2),
+    pair(BOOST_HANA_STRING("depth"), 3)
+));
+
+int value = 0;
+BOOST_HANA_RUNTIME_CHECK(handlers("height", [&](int v) { value = v; }));
+BOOST_HANA_RUNTIME_CHECK(value == 2);
+
+BOOST_HANA_RUNTIME_CHECK(!handlers("weight", [&](int v) { value = v; }));
+BOOST_HANA_RUNTIME_CHECK(value == 2);
+//! [frozen_lookup]
+
 }
 
 }
@@ -25,6 +25,15 @@ BOOST_HANA_CONSTANT_CHECK(all_of(tuple_c<int, 1, 2, 3, 4>, less_equal.than(int_<
 
 }{
 
+//! [compare]
+BOOST_HANA_CONSTEXPR_CHECK(compare(1, 4) < 0);
+BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(1, 'x'), make<Tuple>(1, 'a')) > 0);
+BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(1, 2), make<Tuple>(1, 2, 3)) < 0);
+BOOST_HANA_CONSTANT_CHECK(compare(int_<3>, int_<3>) == int_<0>);
+//! [compare]
+
+}{
+
 //! [greater]
 BOOST_HANA_CONSTEXPR_CHECK(greater(4, 1));
 BOOST_HANA_CONSTANT_CHECK(!greater(int_<1>, int_<3>));
@@ -0,0 +1,61 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/packed_tuple.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [make<PackedTuple>]
+auto xs = make<PackedTuple>(1, '2', 3.3, std::string{"456"});
+BOOST_HANA_RUNTIME_CHECK(at_c<1>(xs) == '2');
+BOOST_HANA_RUNTIME_CHECK(at_c<3>(xs) == "456");
+//! [make<PackedTuple>]
+
+}{
+
+//! [layout]
+auto event = packed_tuple('a', 1.5, 'b', 2.5, true);
+
+// The doubles are stored first, followed by the chars and the bool, so
+// there is no padding between the elements.
+static_assert(sizeof(event) < sizeof(make<Tuple>('a', 1.5, 'b', 2.5, true)), "");
+
+// The elements are still accessed in the order they were given
+BOOST_HANA_RUNTIME_CHECK(at_c<0>(event) == 'a');
+BOOST_HANA_RUNTIME_CHECK(at_c<1>(event) == 1.5);
+BOOST_HANA_RUNTIME_CHECK(event[size_t<4>] == true);
+//! [layout]
+
+}{
+
+//! [sequence]
+BOOST_HANA_CONSTEXPR_CHECK(
+    transform(packed_tuple('a', 1.5, 2), [](auto x) { return x + 1; })
+        ==
+    packed_tuple('a' + 1, 2.5, 3)
+);
+
+BOOST_HANA_CONSTEXPR_CHECK(
+    to<Tuple>(packed_tuple('a', 1.5, 2)) == make<Tuple>('a', 1.5, 2)
+);
+
+BOOST_HANA_CONSTEXPR_CHECK(
+    to<PackedTuple>(make<Tuple>('a', 1.5, 2)) == packed_tuple('a', 1.5, 2)
+);
+//! [sequence]
+
+}
+
+}
@@ -75,6 +75,35 @@ BOOST_HANA_CONSTANT_CHECK(last(range_c<unsigned long, 0, 5>) == ulong<4>);
 BOOST_HANA_CONSTANT_CHECK(tail(range_c<int, 0, 5>) == range(int_<1>, int_<5>));
 //! [range_c]
 
+}{
+
+//! [dispatch]
+// Runtime parameters selecting a kernel specialized at compile-time.
+int width = 4, arity = 2;
+int result = 0;
+auto kernel = [&](auto width, auto arity) {
+    // `width` and `arity` are Constants here.
+    result = value(width) * 10 + value(arity);
+};
+
+BOOST_HANA_RUNTIME_CHECK(dispatch(range_c<int, 1, 17>, width, [&](auto w) {
+    kernel(w, int_<0>);
+}));
+BOOST_HANA_RUNTIME_CHECK(result == 40);
+
+BOOST_HANA_RUNTIME_CHECK(dispatch(
+    make<Tuple>(range_c<int, 1, 17>, range_c<int, 0, 9>),
+    make<Tuple>(width, arity),
+    kernel
+));
+BOOST_HANA_RUNTIME_CHECK(result == 42);
+
+// Values outside of the ranges are not dispatched.
+BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<int, 1, 17>, 17, [&](auto w) {
+    kernel(w, int_<0>);
+}));
+//! [dispatch]
+
 }
 
 }
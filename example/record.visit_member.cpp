@@ -0,0 +1,44 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/record_macros.hpp>
+
+#include <sstream>
+#include <string>
+using namespace boost::hana;
+
+
+struct Person {
+    BOOST_HANA_DEFINE_RECORD_INTRUSIVE(Person,
+        (std::string, name),
+        (int, age)
+    );
+};
+
+// Assigns the member with the given name from its textual representation.
+bool set(Person& person, std::string const& name, std::string const& value) {
+    return visit_member(person, name, [&](auto& member) {
+        std::istringstream in{value};
+        in >> member;
+    });
+}
+
+int main() {
+    Person john{"John", 30};
+
+    BOOST_HANA_RUNTIME_CHECK(set(john, "age", "31"));
+    BOOST_HANA_RUNTIME_CHECK(john.age == 31);
+
+    BOOST_HANA_RUNTIME_CHECK(set(john, "name", "Johnny"));
+    BOOST_HANA_RUNTIME_CHECK(john.name == "Johnny");
+
+    BOOST_HANA_RUNTIME_CHECK(!set(john, "height", "180"));
+
+    std::ostringstream out;
+    visit_member(john, "age", [&](int const& age) { out << age; });
+    BOOST_HANA_RUNTIME_CHECK(out.str() == "31");
+}
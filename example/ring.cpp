@@ -31,6 +31,10 @@ BOOST_HANA_CONSTEXPR_CHECK(one<long>() == 1l);
 //! [power]
 BOOST_HANA_CONSTANT_CHECK(power(int_<3>, int_<2>) == int_<3 * 3>);
 BOOST_HANA_CONSTEXPR_CHECK(power(2, int_<4>) == 16);
+
+// the exponent may also be known only at runtime
+int n = 10;
+BOOST_HANA_RUNTIME_CHECK(power(2, n) == 1024);
 //! [power]
 
 }
@@ -0,0 +1,66 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/serialization.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <utility>
+#include <vector>
+using namespace boost::hana;
+
+
+//! [serialize]
+struct Quote {
+    int bid;
+    int ask;
+    double time;
+    std::vector<int> sizes;
+};
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Quote> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply() {
+            return make<Tuple>(
+                make<Pair>(BOOST_HANA_STRING("bid"), [](auto&& q) -> decltype(auto) {
+                    return id(std::forward<decltype(q)>(q).bid);
+                }),
+                make<Pair>(BOOST_HANA_STRING("ask"), [](auto&& q) -> decltype(auto) {
+                    return id(std::forward<decltype(q)>(q).ask);
+                }),
+                make<Pair>(BOOST_HANA_STRING("time"), [](auto&& q) -> decltype(auto) {
+                    return id(std::forward<decltype(q)>(q).time);
+                }),
+                make<Pair>(BOOST_HANA_STRING("sizes"), [](auto&& q) -> decltype(auto) {
+                    return id(std::forward<decltype(q)>(q).sizes);
+                })
+            );
+        }
+    };
+}}
+
+int main() {
+    Quote quote{100, 101, 12.5, {10, 20, 30}};
+
+    // `bid`, `ask` and `time` are adjacent in memory, so they are written
+    // with a single memcpy. `sizes` is written as its size followed by the
+    // elements, which are also written with a single memcpy.
+    std::vector<char> buffer(serialized_size(quote));
+    BOOST_HANA_RUNTIME_CHECK(buffer.size() ==
+        2 * sizeof(int) + sizeof(double) + sizeof(unsigned long long) + 3 * sizeof(int));
+    serialize(quote, buffer.data());
+
+    Quote copy = deserialize<Quote>(buffer.data(), buffer.data() + buffer.size());
+    BOOST_HANA_RUNTIME_CHECK(equal(copy, quote));
+}
+//! [serialize]
@@ -76,6 +76,32 @@ BOOST_HANA_CONSTANT_CHECK(
 );
 //! [insert]
 
+}{
+
+//! [union_]
+constexpr auto xs = set(type<int>, type<char>);
+constexpr auto ys = set(type<char>, type<float>);
+BOOST_HANA_CONSTANT_CHECK(
+    union_(xs, ys) == set(type<int>, type<char>, type<float>)
+);
+//! [union_]
+
+}{
+
+//! [intersection]
+constexpr auto xs = set(type<int>, type<char>);
+constexpr auto ys = set(type<char>, type<float>);
+BOOST_HANA_CONSTANT_CHECK(intersection(xs, ys) == set(type<char>));
+//! [intersection]
+
+}{
+
+//! [difference]
+constexpr auto xs = set(type<int>, type<char>);
+constexpr auto ys = set(type<char>, type<float>);
+BOOST_HANA_CONSTANT_CHECK(difference(xs, ys) == set(type<int>));
+//! [difference]
+
 }
 
 }
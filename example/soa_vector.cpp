@@ -0,0 +1,72 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/record_macros.hpp>
+#include <boost/hana/soa_vector.hpp>
+#include <boost/hana/string.hpp>
+
+#include <string>
+#include <vector>
+using namespace boost::hana;
+
+
+struct Order {
+    std::string symbol;
+    double price;
+    int quantity;
+};
+
+BOOST_HANA_DEFINE_RECORD(Order,
+    (std::string, symbol),
+    (double, price),
+    (int, quantity)
+);
+
+int main() {
+
+{
+
+//! [main]
+soa_vector<Order> orders;
+orders.push_back(Order{"ABC", 10.5, 100});
+orders.push_back(Order{"XYZ", 2.25, 40});
+
+// Each member is stored in its own std::vector
+std::vector<double>& prices = orders[BOOST_HANA_STRING("price")];
+BOOST_HANA_RUNTIME_CHECK(prices.size() == 2);
+
+double total = 0;
+for (double price : prices)
+    total += price;
+BOOST_HANA_RUNTIME_CHECK(total == 12.75);
+
+// Elements are accessed through proxies
+orders[1][BOOST_HANA_STRING("quantity")] = 50;
+orders[0] = Order{"DEF", 11.0, 10};
+
+Order first = orders[0];
+BOOST_HANA_RUNTIME_CHECK(first.symbol == "DEF");
+BOOST_HANA_RUNTIME_CHECK(orders[1][BOOST_HANA_STRING("quantity")] == 50);
+//! [main]
+
+}{
+
+//! [Record]
+soa_vector<Order> orders;
+orders.push_back(Order{"ABC", 10.5, 100});
+
+std::size_t elements = 0;
+for_each(orders, [&](auto const& column) {
+    elements += column.size();
+});
+BOOST_HANA_RUNTIME_CHECK(elements == 3);
+//! [Record]
+
+}
+
+}
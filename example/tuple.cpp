@@ -84,6 +84,24 @@ BOOST_HANA_CONSTEXPR_CHECK(
 );
 //! [Tuple_interop]
 
+}{
+
+//! [arithmetic]
+BOOST_HANA_CONSTEXPR_CHECK(
+    make<Tuple>(1, 2.5, 3u) + make<Tuple>(4, 0.5, 6u) == make<Tuple>(5, 3.0, 9u)
+);
+
+BOOST_HANA_CONSTEXPR_CHECK(
+    make<Tuple>(1, 2) * make<Tuple>(3, 4) - make<Tuple>(1, 1) == make<Tuple>(2, 7)
+);
+
+// Tuples of Constants are combined at compile-time
+BOOST_HANA_CONSTANT_CHECK(
+    tuple_c<int, 1, 2, 3> + tuple_c<int, 10, 20, 30> == tuple_c<int, 11, 22, 33>
+);
+BOOST_HANA_CONSTANT_CHECK(-tuple_c<int, 1, -2> == tuple_c<int, -1, 2>);
+//! [arithmetic]
+
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/view.hpp>
+
+#include <string>
+#include <type_traits>
+using namespace boost::hana;
+
+
+int main() {
+
+{
+
+//! [foldable]
+auto xs = make<Tuple>(1, 2, 3, 4);
+auto squares = transformed(xs, [](int x) { return x * x; });
+BOOST_HANA_RUNTIME_CHECK(foldl(squares, 0, [](int s, int x) { return s + x; }) == 30);
+BOOST_HANA_RUNTIME_CHECK(unpack(squares, [](auto ...x) { return sizeof...(x); }) == 4);
+//! [foldable]
+
+}{
+
+//! [iterable]
+auto xs = make<Tuple>(1, '2', std::string{"3"});
+auto v = reversed(xs);
+BOOST_HANA_RUNTIME_CHECK(head(v) == "3");
+BOOST_HANA_RUNTIME_CHECK(v[int_<1>] == '2');
+BOOST_HANA_RUNTIME_CHECK(last(v) == 1);
+BOOST_HANA_CONSTANT_CHECK(length(tail(v)) == size_t<2>);
+
+// Views refer to the elements of the tuple.
+v[int_<0>] += "!";
+BOOST_HANA_RUNTIME_CHECK(at_c<2>(xs) == "3!");
+//! [iterable]
+
+}{
+
+//! [searchable]
+auto xs = make<Tuple>(1, 2.0, '3');
+auto v = joined(xs, xs);
+BOOST_HANA_RUNTIME_CHECK(find_if(v, [](auto x) {
+    return bool_<std::is_floating_point<decltype(x)>{}>;
+}) == just(2.0));
+BOOST_HANA_CONSTANT_CHECK(!any_of(v, [](auto x) {
+    return bool_<std::is_same<decltype(x), long>{}>;
+}));
+//! [searchable]
+
+}{
+
+//! [to<Tuple>]
+auto xs = make<Tuple>(1, 2, 3);
+auto ys = to<Tuple>(transformed(reversed(xs), [](int x) { return x * 10; }));
+BOOST_HANA_RUNTIME_CHECK(ys == make<Tuple>(30, 20, 10));
+//! [to<Tuple>]
+
+}{
+
+//! [viewed]
+auto xs = make<Tuple>(1, '2', std::string{"3"});
+auto v = viewed(xs);
+BOOST_HANA_RUNTIME_CHECK(head(tail(v)) == '2');
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(drop_c<1>(v)) == make<Tuple>('2', std::string{"3"}));
+
+// `tail(v)` and `drop_c<1>(v)` refer to the elements of `xs` without
+// copying them.
+head(drop_c<2>(v)) += "!";
+BOOST_HANA_RUNTIME_CHECK(at_c<2>(xs) == "3!");
+//! [viewed]
+
+}{
+
+//! [transformed]
+auto xs = make<Tuple>(1, 2.5, '3');
+auto v = transformed(xs, [](auto x) { return x + 1; });
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(v) == make<Tuple>(2, 3.5, '4'));
+//! [transformed]
+
+}{
+
+//! [filtered]
+auto xs = make<Tuple>(1, 2.0, 3, 4.0f);
+auto ints = filtered(xs, [](auto x) {
+    return bool_<std::is_integral<decltype(x)>{}>;
+});
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(ints) == make<Tuple>(1, 3));
+//! [filtered]
+
+}{
+
+//! [sliced]
+auto xs = make<Tuple>(0, '1', 2.0, 3u);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(sliced(xs, int_<1>, int_<3>)) == make<Tuple>('1', 2.0));
+BOOST_HANA_CONSTANT_CHECK(is_empty(sliced(xs, int_<2>, int_<2>)));
+//! [sliced]
+
+}{
+
+//! [reversed]
+auto xs = make<Tuple>(1, '2', 3.0);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(reversed(xs)) == make<Tuple>(3.0, '2', 1));
+//! [reversed]
+
+}{
+
+//! [joined]
+auto xs = make<Tuple>(1, '2');
+auto ys = make<Tuple>(3.0);
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(joined(xs, ys)) == make<Tuple>(1, '2', 3.0));
+BOOST_HANA_RUNTIME_CHECK(to<Tuple>(joined(reversed(ys), reversed(xs))) ==
+                         make<Tuple>(3.0, '2', 1));
+//! [joined]
+
+}
+
+}
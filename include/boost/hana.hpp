@@ -43,16 +43,19 @@ Distributed under the Boost Software License, Version 1.0.
 // Data types
 #include <boost/hana/bool.hpp>
 #include <boost/hana/either.hpp>
+#include <boost/hana/homogeneous_tuple.hpp>
 #include <boost/hana/integral_constant.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/map.hpp>
 #include <boost/hana/maybe.hpp>
+#include <boost/hana/packed_tuple.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/range.hpp>
 #include <boost/hana/set.hpp>
 #include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/type.hpp>
+#include <boost/hana/view.hpp>
 
 // Misc
 #include <boost/hana/assert.hpp>
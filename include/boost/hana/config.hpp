@@ -164,4 +164,32 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONFIG_CHECK_DATA_TYPES
 #endif
 
+#if defined(BOOST_HANA_DOXYGEN_INVOKED)
+    //! @ingroup group-config
+    //! Width, in bytes, of the vector registers targeted by the runtime
+    //! algorithms on arrays of arithmetic types.
+    //!
+    //! Algorithms like `sum`, `count_if` or `any_of` on builtin arrays and
+    //! `std::array`s of arithmetic types process the elements in as many
+    //! independent lanes as fit in a vector register of this width, so the
+    //! compiler can map every lane to a slot of a SIMD register. By default,
+    //! this is deduced from the instruction set enabled on the command line
+    //! (64 for AVX-512, 32 for AVX, 16 for SSE2, NEON and AltiVec), and it
+    //! is 1 otherwise, which processes the elements one at a time. It can
+    //! also be defined by users before including this header or defined on
+    //! the command line.
+#   define BOOST_HANA_CONFIG_VECTOR_WIDTH implementation-defined
+#elif !defined(BOOST_HANA_CONFIG_VECTOR_WIDTH)
+#   if defined(__AVX512F__)
+#       define BOOST_HANA_CONFIG_VECTOR_WIDTH 64
+#   elif defined(__AVX__)
+#       define BOOST_HANA_CONFIG_VECTOR_WIDTH 32
+#   elif defined(__SSE2__) || defined(_M_X64) || defined(__ARM_NEON) || \
+         defined(__ALTIVEC__)
+#       define BOOST_HANA_CONFIG_VECTOR_WIDTH 16
+#   else
+#       define BOOST_HANA_CONFIG_VECTOR_WIDTH 1
+#   endif
+#endif
+
 #endif // !BOOST_HANA_CONFIG_HPP
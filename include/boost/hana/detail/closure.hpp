@@ -13,12 +13,93 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/forward.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_empty.hpp>
+#include <boost/hana/detail/std/is_final.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 
 
 namespace boost { namespace hana { namespace detail {
+    template <typename ...Xs>
+    struct closure_impl;
+
+    namespace closure_detail {
+        template <typename ...Xs>
+        constexpr bool is_closure(closure_impl<Xs...> const*)
+        { return true; }
+
+        constexpr bool is_closure(...)
+        { return false; }
+
+        // Closures are never stored as base classes, because it would make
+        // the pattern matching on `closure_impl` and `element` ambiguous.
+        template <typename Xn, bool = detail::std::is_empty<Xn>{} &&
+                                      !detail::std::is_final<Xn>{}>
+        struct use_ebo {
+            static constexpr bool value = !is_closure((Xn*)nullptr);
+        };
+
+        template <typename Xn>
+        struct use_ebo<Xn, false> {
+            static constexpr bool value = false;
+        };
+
+        template <typename Xn, bool = use_ebo<Xn>::value>
+        struct storage {
+            Xn value_;
+
+            storage() = default;
+
+            template <typename Y>
+            explicit constexpr storage(Y&& y)
+                : value_{detail::std::forward<Y>(y)}
+            { }
+
+            constexpr Xn const& get() const& { return value_; }
+            constexpr Xn& get() & { return value_; }
+            constexpr Xn&& get() && { return static_cast<Xn&&>(value_); }
+        };
+
+        // The base is private so the closure does not convert to `Xn`.
+        // However, the members of `Xn` are still found by name lookup on
+        // the closure, so containers built on it must redeclare the members
+        // they expose, like `operator[]` in `_tuple`.
+        template <typename Xn>
+        struct storage<Xn, true> : private Xn {
+            storage() = default;
+
+            template <typename Y>
+            explicit constexpr storage(Y&& y)
+                : Xn{detail::std::forward<Y>(y)}
+            { }
+
+            constexpr Xn const& get() const& { return *this; }
+            constexpr Xn& get() & { return *this; }
+            constexpr Xn&& get() && { return static_cast<Xn&&>(*this); }
+        };
+
+        // Used to make the constructor of `element` SFINAE-friendly. This
+        // checks that `Xn` can be initialized from `y` like an aggregate
+        // member, which forbids narrowing conversions. `storage` is
+        // initialized with braces too, so that both agree on brace elision.
+        template <typename Xn>
+        struct aggregate { Xn member; };
+
+        struct from_value { };
+    }
+
     template <detail::std::size_t n, typename Xn>
-    struct element { Xn get; using get_type = Xn; };
+    struct element : closure_detail::storage<Xn> {
+        using get_type = Xn;
+
+        element() = default;
+
+        template <typename Y, typename = decltype(
+            closure_detail::aggregate<Xn>{detail::std::declval<Y>()}
+        )>
+        constexpr element(closure_detail::from_value, Y&& y)
+            : closure_detail::storage<Xn>(detail::std::forward<Y>(y))
+        { }
+    };
 
     void swallow(...);
 
@@ -32,10 +113,11 @@ namespace boost { namespace hana { namespace detail {
 
         // Make sure the constructor is SFINAE-friendly.
         template <typename ...Ys, typename = decltype(swallow(
-            (Xs{detail::std::declval<Ys>()}, void(), 0)...
+            (Xs{closure_detail::from_value{}, detail::std::declval<Ys>()},
+             void(), 0)...
         ))>
         constexpr closure_impl(Ys&& ...y)
-            : Xs{detail::std::forward<Ys>(y)}...
+            : Xs{closure_detail::from_value{}, detail::std::forward<Ys>(y)}...
         { }
     };
 
@@ -71,7 +153,14 @@ namespace boost { namespace hana { namespace detail {
     //! possible to retrieve an object from the closure based on its index.
     //! Also note that `element<n, Xn>` is guaranteed to have a nested
     //! `get_type` alias equivalent to `Xn`, which is handy to retrieve
-    //! that `Xn` without having to do pattern matching.
+    //! that `Xn` without having to do pattern matching, and a `get()` member
+    //! function returning the stored object with the value category of the
+    //! `element` it is called on.
+    //!
+    //! When `Xn` is an empty and non-final class type (e.g. a `Type`, an
+    //! `IntegralConstant` or a stateless function object), `element<n, Xn>`
+    //! derives from it instead of holding it as a member. Hence, such objects
+    //! do not take any space inside the closure.
     template <typename ...Xs>
     using closure = typename make_closure_impl<
         detail::std::make_index_sequence<sizeof...(Xs)>, Xs...
@@ -82,17 +171,17 @@ namespace boost { namespace hana { namespace detail {
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn const&
     get(element<n, Xn> const& x)
-    { return x.get; }
+    { return x.get(); }
 
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn&
     get(element<n, Xn>& x)
-    { return x.get; }
+    { return x.get(); }
 
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn&&
     get(element<n, Xn>&& x)
-    { return static_cast<element<n, Xn>&&>(x).get; }
+    { return static_cast<element<n, Xn>&&>(x).get(); }
 }}} // end namespace boost::hana::detail
 
 #endif // !BOOST_HANA_DETAIL_CLOSURE_HPP
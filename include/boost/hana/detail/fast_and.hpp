@@ -0,0 +1,29 @@
+/*!
+@file
+Defines `boost::hana::detail::fast_and`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_FAST_AND_HPP
+#define BOOST_HANA_DETAIL_FAST_AND_HPP
+
+#include <boost/hana/detail/std/is_same.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    template <bool ...b>
+    struct bools;
+
+    //! @ingroup group-details
+    //! Whether all the given booleans are true, without instantiating a
+    //! template for each of them.
+    template <bool ...b>
+    struct fast_and
+        : detail::std::is_same<bools<b...>, bools<(b, true)...>>
+    { };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_FAST_AND_HPP
@@ -0,0 +1,31 @@
+/*!
+@file
+Defines `boost::hana::detail::first_difference`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_FIRST_DIFFERENCE_HPP
+#define BOOST_HANA_DETAIL_FIRST_DIFFERENCE_HPP
+
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Returns the first non-zero result of the given three-way comparisons,
+    //! or zero if all of them are zero.
+    //!
+    //! This is the result of a lexicographical comparison whose results
+    //! for each element are known at compile-time.
+    template <detail::std::size_t N>
+    constexpr int first_difference(int const (&orders)[N]) {
+        for (int order : orders)
+            if (order != 0) return order;
+        return 0;
+    }
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_FIRST_DIFFERENCE_HPP
@@ -0,0 +1,49 @@
+/*!
+@file
+Defines the `BOOST_HANA_PP_FOR_EACH_REF*` macros.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_FOR_EACH_REF_HPP
+#define BOOST_HANA_DETAIL_FOR_EACH_REF_HPP
+
+//! @ingroup group-details
+//! Expands `MACRO(REF)` for each of the reference qualifiers with which a
+//! container can be passed to a method, i.e. `const&`, `&` and `&&`.
+//!
+//! This is used to define overloads of a method for each value category
+//! of its arguments, without having to repeat them by hand. The variants
+//! with more arguments expand the macro with all the combinations of
+//! `const&` and `&&` for the qualifiers of two or three arguments.
+#define BOOST_HANA_PP_FOR_EACH_REF1(MACRO)                              \
+    MACRO(const&)                                                       \
+    MACRO(&)                                                            \
+    MACRO(&&)                                                           \
+/**/
+
+//! @ingroup group-details
+//! See `BOOST_HANA_PP_FOR_EACH_REF1`.
+#define BOOST_HANA_PP_FOR_EACH_REF2(MACRO)                              \
+    MACRO(const&, const&)                                               \
+    MACRO(const&, &&    )                                               \
+    MACRO(&&    , const&)                                               \
+    MACRO(&&    , &&    )                                               \
+/**/
+
+//! @ingroup group-details
+//! See `BOOST_HANA_PP_FOR_EACH_REF1`.
+#define BOOST_HANA_PP_FOR_EACH_REF3(MACRO)                              \
+    MACRO(const&, const&, const&)                                       \
+    MACRO(const&, const&, &&    )                                       \
+    MACRO(const&, &&    , const&)                                       \
+    MACRO(const&, &&    , &&    )                                       \
+    MACRO(&&    , const&, const&)                                       \
+    MACRO(&&    , const&, &&    )                                       \
+    MACRO(&&    , &&    , const&)                                       \
+    MACRO(&&    , &&    , &&    )                                       \
+/**/
+
+#endif // !BOOST_HANA_DETAIL_FOR_EACH_REF_HPP
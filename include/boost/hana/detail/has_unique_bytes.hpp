@@ -0,0 +1,57 @@
+/*!
+@file
+Defines `boost::hana::detail::has_unique_bytes`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_HAS_UNIQUE_BYTES_HPP
+#define BOOST_HANA_DETAIL_HAS_UNIQUE_BYTES_HPP
+
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_enum.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/is_trivially_copyable.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! Whether two objects of type `X` are equal if and only if their bytes
+    //! are equal.
+    //!
+    //! This is the case for integral and enumeration values. The models of
+    //! `Record`, `Tuple` and `Pair` specialize this for trivially copyable
+    //! objects whose members have this property and cover all the bytes of
+    //! the object, i.e. when there is no padding; see `packed`.
+    template <typename X, typename T = typename datatype<X>::type,
+              typename = void>
+    struct has_unique_bytes
+        : detail::std::integral_constant<bool,
+            detail::std::is_same<T, X>{} &&
+            (detail::std::is_integral<X>{} || detail::std::is_enum<X>{})
+        >
+    { };
+
+    //! @ingroup group-details
+    //! Whether an object of type `X` made of members of the given types has
+    //! unique bytes.
+    template <typename X, typename ...Members>
+    constexpr bool packed() {
+        bool unique[] = {true, has_unique_bytes<Members>::value...};
+        detail::std::size_t sizes[] = {0, sizeof(Members)...};
+        detail::std::size_t size = 0;
+        for (detail::std::size_t i = 0; i != sizeof...(Members) + 1; ++i) {
+            if (!unique[i])
+                return false;
+            size += sizes[i];
+        }
+        return detail::std::is_trivially_copyable<X>{} && size == sizeof(X);
+    }
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_HAS_UNIQUE_BYTES_HPP
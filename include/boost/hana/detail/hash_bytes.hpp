@@ -0,0 +1,71 @@
+/*!
+@file
+Defines `boost::hana::detail::hash_bytes`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_HASH_BYTES_HPP
+#define BOOST_HANA_DETAIL_HASH_BYTES_HPP
+
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    namespace hash_bytes_detail {
+        // The bytes are read eight (or four) at a time with loads that the
+        // compiler turns into single instructions, and the last block
+        // overlaps the previous one instead of being read one byte at a
+        // time.
+        constexpr unsigned long long byte(char const* s, unsigned shift) {
+            return static_cast<unsigned long long>(
+                        static_cast<unsigned char>(*s)) << shift;
+        }
+
+        constexpr unsigned long long load4(char const* s) {
+            return byte(s + 0, 0) | byte(s + 1, 8) |
+                   byte(s + 2, 16) | byte(s + 3, 24);
+        }
+
+        constexpr unsigned long long load8(char const* s)
+        { return load4(s) | load4(s + 4) << 32; }
+    }
+
+    //! @ingroup group-details
+    //! Scrambles the bits of a 64 bits integer.
+    constexpr unsigned long long hash_mix(unsigned long long h) {
+        h ^= h >> 31;
+        h *= 0xbf58476d1ce4e5b9ull;
+        h ^= h >> 29;
+        return h;
+    }
+
+    //! @ingroup group-details
+    //! Hash of `length` bytes, usable both at compile-time and at runtime.
+    constexpr unsigned long long
+    hash_bytes(char const* s, detail::std::size_t length) {
+        using hash_bytes_detail::byte;
+        using hash_bytes_detail::load4;
+        using hash_bytes_detail::load8;
+
+        unsigned long long h = 0x9e3779b97f4a7c15ull ^ length;
+        if (length >= 8) {
+            for (detail::std::size_t i = 0; length - i > 8; i += 8)
+                h = hash_mix(h ^ load8(s + i));
+            return hash_mix(h ^ load8(s + length - 8));
+        }
+        else if (length >= 4) {
+            return hash_mix(h ^ load4(s) ^ load4(s + length - 4) << 32);
+        }
+        else {
+            unsigned long long word = 0;
+            for (unsigned i = 0; i != length; ++i)
+                word |= byte(s + i, 8 * i);
+            return hash_mix(h ^ word);
+        }
+    }
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_HASH_BYTES_HPP
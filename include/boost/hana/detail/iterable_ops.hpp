@@ -0,0 +1,103 @@
+/*!
+@file
+Defines `boost::hana::operators::Iterable_ops`.
+
+The operators are defined apart from the rest of `Iterable`, so that
+containers can provide them without including `boost/hana/iterable.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_ITERABLE_OPS_HPP
+#define BOOST_HANA_DETAIL_ITERABLE_OPS_HPP
+
+#include <boost/hana/fwd/integral_constant.hpp>
+#include <boost/hana/fwd/iterable.hpp>
+
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/is_lvalue_reference.hpp>
+#include <boost/hana/detail/std/is_rvalue_reference.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana {
+    namespace iterable_detail {
+        template <typename I, typename Xs>
+        constexpr decltype(auto) subscript(decltype(false_), I&& i, Xs&& xs) {
+            return hana::at(detail::std::forward<I>(i),
+                            detail::std::forward<Xs>(xs));
+        }
+
+        // `xs[i]` with a built-in integer; the element is selected at
+        // runtime and returned with the same reference type as `at`.
+        // Like `std::array::operator[]`, it does not check `i`; the
+        // behavior is undefined when `i` is not a valid index.
+        template <typename I, typename Xs>
+        decltype(auto) subscript(decltype(true_), I i, Xs&& xs) {
+            using Reference = decltype(
+                hana::at(size_t<0>, detail::std::forward<Xs>(xs))
+            );
+            static_assert(detail::std::is_lvalue_reference<Reference>{} ||
+                          detail::std::is_rvalue_reference<Reference>{},
+            "hana::operators::Iterable_ops: xs[i] with an index known at "
+            "runtime requires hana::at(n, xs) to return a reference");
+
+            typename detail::std::remove_reference<Reference>::type* x = nullptr;
+            hana::visit_at(
+                static_cast<detail::std::size_t>(i),
+                detail::std::forward<Xs>(xs), [&x](auto&& xi) {
+                    static_assert(detail::std::is_same<decltype(xi), Reference>{},
+                    "hana::operators::Iterable_ops: xs[i] with an index known at "
+                    "runtime requires all the elements of xs to have the same type");
+                    x = &xi;
+                }
+            );
+            return static_cast<Reference>(*x);
+        }
+
+        template <typename I>
+        using is_runtime_index = _integral_constant<bool,
+            detail::std::is_integral<typename detail::std::decay<I>::type>{}
+        >;
+    }
+
+    namespace operators {
+        template <typename Derived>
+        struct Iterable_ops {
+            template <typename I>
+            constexpr decltype(auto) operator[](I&& i) const& {
+                return iterable_detail::subscript(
+                    iterable_detail::is_runtime_index<I>{},
+                    detail::std::forward<I>(i),
+                    static_cast<Derived const&>(*this)
+                );
+            }
+
+            template <typename I>
+            constexpr decltype(auto) operator[](I&& i) & {
+                return iterable_detail::subscript(
+                    iterable_detail::is_runtime_index<I>{},
+                    detail::std::forward<I>(i),
+                    static_cast<Derived&>(*this)
+                );
+            }
+
+            template <typename I>
+            constexpr decltype(auto) operator[](I&& i) && {
+                return iterable_detail::subscript(
+                    iterable_detail::is_runtime_index<I>{},
+                    detail::std::forward<I>(i),
+                    static_cast<Derived&&>(*this)
+                );
+            }
+        };
+    }
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_DETAIL_ITERABLE_OPS_HPP
@@ -42,18 +42,18 @@ namespace boost { namespace hana { namespace detail {
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) const& {
-            return f(detail::std::forward<Y>(y)..., static_cast<X const&>(x).get...);
+            return f(detail::std::forward<Y>(y)..., static_cast<X const&>(x).get()...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) & {
-            return f(detail::std::forward<Y>(y)..., static_cast<X&>(x).get...);
+            return f(detail::std::forward<Y>(y)..., static_cast<X&>(x).get()...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) && {
             return detail::std::move(f)(
-                detail::std::forward<Y>(y)..., static_cast<X&&>(x).get...
+                detail::std::forward<Y>(y)..., static_cast<X&&>(x).get()...
             );
         }
     };
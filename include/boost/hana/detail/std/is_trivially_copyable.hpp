@@ -0,0 +1,23 @@
+/*!
+@file
+Defines an equivalent to `std::is_trivially_copyable`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STD_IS_TRIVIALLY_COPYABLE_HPP
+#define BOOST_HANA_DETAIL_STD_IS_TRIVIALLY_COPYABLE_HPP
+
+#include <boost/hana/detail/std/integral_constant.hpp>
+
+
+namespace boost { namespace hana { namespace detail { namespace std {
+    template <typename T>
+    struct is_trivially_copyable
+        : integral_constant<bool, __is_trivially_copyable(T)>
+    { };
+}}}} // end namespace boost::hana::detail::std
+
+#endif // !BOOST_HANA_DETAIL_STD_IS_TRIVIALLY_COPYABLE_HPP
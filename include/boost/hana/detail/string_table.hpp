@@ -0,0 +1,202 @@
+/*!
+@file
+Defines `boost::hana::detail::string_table`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STRING_TABLE_HPP
+#define BOOST_HANA_DETAIL_STRING_TABLE_HPP
+
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/hash_bytes.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/string.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    namespace string_table_detail {
+        template <typename Key>
+        struct string_key;
+
+        template <char ...s>
+        struct string_key<_string<s...>> {
+            static constexpr char c_str[sizeof...(s) + 1] = {s..., '\0'};
+        };
+
+        template <char ...s>
+        constexpr char string_key<_string<s...>>::c_str[];
+
+        template <typename Key>
+        struct string_length;
+
+        template <char ...s>
+        struct string_length<_string<s...>>
+            : detail::std::integral_constant<detail::std::size_t, sizeof...(s)>
+        { };
+
+        // Mixes the hash of a string with the seed of its bucket, without
+        // having to go through the string again.
+        constexpr unsigned long long
+        rehash(unsigned long long h, unsigned long long seed)
+        { return ((h ^ seed) * 0x9e3779b97f4a7c15ull) >> 32; }
+
+        constexpr detail::std::size_t table_size(detail::std::size_t n) {
+            detail::std::size_t size = 1;
+            while (size < n)
+                size *= 2;
+            return size;
+        }
+
+        // Perfect hash function of `n` keys, built with the "hash, displace"
+        // method: the keys are first distributed in buckets by their hash,
+        // and then a seed is found for each bucket (largest first) such that
+        // rehashing its keys with that seed sends them to free slots.
+        template <detail::std::size_t n>
+        struct perfect_hash {
+            static constexpr detail::std::size_t size = table_size(n);
+            static constexpr detail::std::size_t mask = size - 1;
+            static constexpr unsigned long long max_seed = 1 << 16;
+
+            // `slots[i]` is the index of the key hashed to `i`, or `n`.
+            detail::array<unsigned long long, size> seeds;
+            detail::array<detail::std::size_t, size> slots;
+            bool complete;
+
+            static constexpr perfect_hash
+            make(detail::array<unsigned long long, n> const& hashes) {
+                perfect_hash result{{{}}, {{}}, true};
+                for (detail::std::size_t i = 0; i != size; ++i)
+                    result.slots[i] = n;
+
+                // Sort the keys by bucket, so the keys of bucket `b` are
+                // `keys[first[b]]` up to `keys[first[b + 1]]`.
+                detail::std::size_t first[size + 1] = {};
+                detail::std::size_t keys[n == 0 ? 1 : n] = {};
+                detail::std::size_t largest = 0;
+                for (detail::std::size_t i = 0; i != n; ++i)
+                    ++first[(hashes[i] & mask) + 1];
+                for (detail::std::size_t b = 0; b != size; ++b) {
+                    if (first[b + 1] > largest)
+                        largest = first[b + 1];
+                    first[b + 1] += first[b];
+                }
+                detail::std::size_t next[size] = {};
+                for (detail::std::size_t i = 0; i != n; ++i) {
+                    detail::std::size_t b = hashes[i] & mask;
+                    keys[first[b] + next[b]++] = i;
+                }
+
+                for (detail::std::size_t k = largest; k != 0; --k) {
+                    for (detail::std::size_t b = 0; b != size; ++b) {
+                        if (first[b + 1] - first[b] != k)
+                            continue;
+
+                        unsigned long long seed = 1;
+                        while (seed != max_seed && !fits(result.slots, hashes,
+                                    keys + first[b], k, seed))
+                            ++seed;
+
+                        result.complete &= seed != max_seed;
+                        result.seeds[b] = seed;
+                        for (auto j = first[b]; j != first[b + 1]; ++j)
+                            result.slots[slot(hashes[keys[j]], seed)] = keys[j];
+                    }
+                }
+                return result;
+            }
+
+            // Whether rehashing the `k` given keys with `seed` sends them
+            // to distinct free slots.
+            static constexpr bool
+            fits(detail::array<detail::std::size_t, size> const& slots,
+                 detail::array<unsigned long long, n> const& hashes,
+                 detail::std::size_t const* keys, detail::std::size_t k,
+                 unsigned long long seed)
+            {
+                for (detail::std::size_t i = 0; i != k; ++i) {
+                    detail::std::size_t s = slot(hashes[keys[i]], seed);
+                    if (slots[s] != n)
+                        return false;
+                    for (detail::std::size_t j = 0; j != i; ++j)
+                        if (slot(hashes[keys[j]], seed) == s)
+                            return false;
+                }
+                return true;
+            }
+
+            static constexpr detail::std::size_t
+            slot(unsigned long long h, unsigned long long seed)
+            { return rehash(h, seed) & mask; }
+
+            // Index of the only key which can be equal to a string with
+            // the given hash, or `n` if there is none.
+            constexpr detail::std::size_t
+            candidate(unsigned long long h) const
+            { return slots[slot(h, seeds[h & mask])]; }
+        };
+
+    }
+
+    //! @ingroup group-details
+    //! Set of compile-time `String`s which can be searched with a runtime
+    //! string.
+    //!
+    //! A perfect hash function of the keys is computed at compile-time, so
+    //! `find` only hashes the searched string once and compares it with a
+    //! single key. `distinct` tells whether the perfect hash function could
+    //! be built, which is the case when the keys are distinct.
+    template <typename ...Keys>
+    struct string_table {
+        static constexpr detail::std::size_t n = sizeof...(Keys);
+
+        static constexpr char const* keys[n == 0 ? 1 : n] = {
+            string_table_detail::string_key<Keys>::c_str...
+        };
+
+        static constexpr detail::std::size_t lengths[n == 0 ? 1 : n] = {
+            string_table_detail::string_length<Keys>::value...
+        };
+
+        static constexpr string_table_detail::perfect_hash<sizeof...(Keys)> hash =
+            string_table_detail::perfect_hash<sizeof...(Keys)>::make({{
+                detail::hash_bytes(
+                    string_table_detail::string_key<Keys>::c_str,
+                    string_table_detail::string_length<Keys>::value
+                )...
+            }});
+
+        static constexpr bool distinct = hash.complete;
+
+        //! Returns the index of the key equal to the `length` characters
+        //! pointed to by `str`, or `n` if there is no such key.
+        static detail::std::size_t
+        find(char const* str, detail::std::size_t length) {
+            detail::std::size_t i = hash.candidate(
+                            detail::hash_bytes(str, length));
+            if (i == n || lengths[i] != length)
+                return n;
+
+            char const* key = keys[i];
+            for (detail::std::size_t j = 0; j != length; ++j)
+                if (str[j] != key[j])
+                    return n;
+            return i;
+        }
+    };
+
+    template <typename ...Keys>
+    constexpr char const* string_table<Keys...>::keys[];
+
+    template <typename ...Keys>
+    constexpr detail::std::size_t string_table<Keys...>::lengths[];
+
+    template <typename ...Keys>
+    constexpr string_table_detail::perfect_hash<sizeof...(Keys)>
+    string_table<Keys...>::hash;
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_STRING_TABLE_HPP
@@ -0,0 +1,127 @@
+/*!
+@file
+Defines the utilities used by the algorithms of `boost::hana::Tuple` to
+inspect the results of a predicate at compile-time.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_TUPLE_PREDICATES_HPP
+#define BOOST_HANA_DETAIL_TUPLE_PREDICATES_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/std/void_t.hpp>
+
+
+namespace boost { namespace hana { namespace tuple_detail {
+    template <detail::std::size_t N>
+    constexpr bool all(bool const (&bs)[N]) {
+        for (bool b : bs)
+            if (!b) return false;
+        return true;
+    }
+
+    // `X` is the type of the argument passed to the predicate, including
+    // its value category.
+    template <typename Pred, typename X>
+    using predicate_result = typename detail::std::decay<decltype(
+        detail::std::declval<Pred>()(detail::std::declval<X>())
+    )>::type;
+
+    // Whether `pred(x)` is valid and returns a `Constant`. This must not
+    // cause a hard error, since algorithms fall back to their generic
+    // implementation when it does not hold.
+    template <typename Pred, typename X, typename = void>
+    struct returns_constant
+        : detail::std::false_type
+    { };
+
+    template <typename Pred, typename X>
+    struct returns_constant<Pred, X,
+        detail::std::void_t<predicate_result<Pred, X>>
+    >
+        : _models<Constant, typename datatype<predicate_result<Pred, X>>::type>
+    { };
+
+    // Results of a predicate on each element of a tuple. When all of
+    // them are `Constant`s, algorithms like `filter` and `partition` can
+    // compute the indices of their result at once and then build it in
+    // a single step, instead of building it one element at a time.
+    template <typename Pred, typename ...X>
+    struct predicate_results {
+        static constexpr bool is_constant() {
+            bool constant[] = {true, returns_constant<Pred, X>::value...};
+            return all(constant);
+        }
+
+        static constexpr detail::array<bool, sizeof...(X)> values() {
+            return {{static_cast<bool>(
+                hana::value<predicate_result<Pred, X>>()
+            )...}};
+        }
+
+        static constexpr detail::std::size_t count(bool which) {
+            constexpr detail::array<bool, sizeof...(X)> results = values();
+            detail::std::size_t n = 0;
+            for (bool result : results)
+                n += result == which;
+            return n;
+        }
+
+        static constexpr detail::std::size_t find(bool which) {
+            constexpr detail::array<bool, sizeof...(X)> results = values();
+            detail::std::size_t i = 0;
+            while (i < sizeof...(X) && results[i] != which)
+                ++i;
+            return i;
+        }
+    };
+
+    template <typename Pred, typename ...X>
+    predicate_results<Pred, X const&...> predicate_results_of(_tuple<X...> const&);
+
+    template <typename Pred, typename ...X>
+    predicate_results<Pred, X&...> predicate_results_of(_tuple<X...>&);
+
+    template <typename Pred, typename ...X>
+    predicate_results<Pred, X&&...> predicate_results_of(_tuple<X...>&&);
+
+    template <typename Xs, typename Pred>
+    using results_of = decltype(predicate_results_of<
+        typename detail::std::decay<Pred>::type
+    >(detail::std::declval<Xs>()));
+
+    // Generator for `detail::generate_index_sequence` returning the
+    // indices of the elements for which the predicate returned `which`.
+    template <typename Results, bool which>
+    struct indices_where {
+        template <typename Array>
+        constexpr auto operator()(Array indices) const {
+            constexpr auto results = Results::values();
+            detail::std::size_t k = 0;
+            for (detail::std::size_t i = 0; i < results.size(); ++i)
+                if (results[i] == which)
+                    indices[k++] = i;
+            return indices;
+        }
+    };
+
+    template <typename Results, bool which>
+    using where = detail::generate_index_sequence<
+        Results::count(which), indices_where<Results, which>
+    >;
+}}} // end namespace boost::hana::tuple_detail
+
+#endif // !BOOST_HANA_DETAIL_TUPLE_PREDICATES_HPP
@@ -0,0 +1,83 @@
+/*!
+@file
+Defines `boost::hana::detail::type_index` & friends.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_TYPE_INDEX_HPP
+#define BOOST_HANA_DETAIL_TYPE_INDEX_HPP
+
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/core/datatype.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    namespace type_index_detail {
+        template <typename Key, detail::std::size_t i>
+        struct node { };
+
+        template <typename Indices, typename ...Keys>
+        struct make_type_index;
+
+        template <detail::std::size_t ...i, typename ...Keys>
+        struct make_type_index<detail::std::index_sequence<i...>, Keys...> {
+            struct type : node<Keys, i>... { };
+        };
+
+        template <typename Key, detail::std::size_t i>
+        detail::std::integral_constant<detail::std::size_t, i>
+        index_of(node<Key, i> const*);
+
+        template <typename Key>
+        void index_of(...);
+    }
+
+    //! @ingroup group-details
+    //! Empty base class making it possible to find the position of a key in
+    //! a container with a single overload resolution.
+    //!
+    //! `type_index<K0, ..., Kn>` inherits from one empty node per key, which
+    //! is tagged with the key's type and position. A container inheriting
+    //! from it can then be searched with `index_of_type`, instead of comparing
+    //! the searched key with each of its keys in turn.
+    template <typename ...Keys>
+    using type_index = typename type_index_detail::make_type_index<
+        detail::std::make_index_sequence<sizeof...(Keys)>, Keys...
+    >::type;
+
+    //! @ingroup group-details
+    //! Position of the key with exactly the type `Key` in a container
+    //! inheriting from a `type_index`.
+    //!
+    //! This is a `detail::std::integral_constant` holding the position of
+    //! the key, or `void` if no key (or more than one key) has that type.
+    template <typename Container, typename Key>
+    using index_of_type = decltype(type_index_detail::index_of<Key>(
+        (typename detail::std::decay<Container>::type*)nullptr
+    ));
+
+    //! @ingroup group-details
+    //! Whether objects of the data type of `Key` are equal if and only if
+    //! they have the same C++ type.
+    //!
+    //! When that is the case, a key whose type is not in a `type_index` is
+    //! known not to be in the corresponding container.
+    template <typename Key, typename D = typename datatype<Key>::type>
+    struct has_identity_equality
+        : detail::std::integral_constant<bool,
+            detail::std::is_same<D, Type>{} ||
+            detail::std::is_same<D, String>{}
+        >
+    { };
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_TYPE_INDEX_HPP
@@ -0,0 +1,80 @@
+/*!
+@file
+Defines `boost::hana::detail::variadic::tree_fold`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_VARIADIC_TREE_FOLD_HPP
+#define BOOST_HANA_DETAIL_VARIADIC_TREE_FOLD_HPP
+
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/functional/id.hpp>
+
+
+namespace boost { namespace hana { namespace detail { namespace variadic {
+    namespace tree_fold_detail {
+        // Returns the number of elements in the left subtree of a tree
+        // holding `n > 1` elements, which is the largest power of two
+        // smaller than `n`.
+        constexpr detail::std::size_t split(detail::std::size_t n) {
+            detail::std::size_t left = 1;
+            while (left * 2 < n)
+                left *= 2;
+            return left;
+        }
+
+        template <detail::std::size_t from, detail::std::size_t to,
+                  bool = to - from == 1>
+        struct reduce {
+            static constexpr detail::std::size_t mid = from + split(to - from);
+
+            template <typename F, typename Xs>
+            static constexpr decltype(auto) apply(F& f, Xs&& xs) {
+                return f(reduce<from, mid>::apply(f, detail::std::forward<Xs>(xs)),
+                         reduce<mid, to>::apply(f, detail::std::forward<Xs>(xs)));
+            }
+        };
+
+        template <detail::std::size_t from, detail::std::size_t to>
+        struct reduce<from, to, true> {
+            template <typename F, typename Xs>
+            static constexpr decltype(auto) apply(F&, Xs&& xs) {
+                // id handles rvalue-ness properly
+                return id(detail::get<from>(detail::std::forward<Xs>(xs)));
+            }
+        };
+    }
+
+    //! @ingroup group-details
+    //! Reduces `xs...` with a binary function grouping the elements as a
+    //! balanced binary tree.
+    //!
+    //! The left subtree of every node holds the largest power of two of
+    //! elements smaller than the number of elements of the node, so that
+    //! `tree_fold(f, x1, ..., x5)` is
+    //! @code
+    //!     f(f(f(x1, x2), f(x3, x4)), x5)
+    //! @endcode
+    //! The elements are referred to through a closure of references, so
+    //! the depth of the recursion is logarithmic in the number of elements.
+    struct _tree_fold {
+        template <typename F, typename ...Xs>
+        constexpr decltype(auto) operator()(F&& f, Xs&& ...xs) const {
+            static_assert(sizeof...(Xs) > 0,
+            "hana::detail::variadic::tree_fold requires at least one element");
+
+            return tree_fold_detail::reduce<0, sizeof...(Xs)>::apply(f,
+                detail::closure<Xs&&...>{detail::std::forward<Xs>(xs)...}
+            );
+        }
+    };
+
+    constexpr _tree_fold tree_fold{};
+}}}} // end namespace boost::hana::detail::variadic
+
+#endif // !BOOST_HANA_DETAIL_VARIADIC_TREE_FOLD_HPP
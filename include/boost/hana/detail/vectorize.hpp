@@ -0,0 +1,194 @@
+/*!
+@file
+Defines the `boost::hana::detail::vectorize` kernels.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_VECTORIZE_HPP
+#define BOOST_HANA_DETAIL_VECTORIZE_HPP
+
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_arithmetic.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+
+
+namespace boost { namespace hana { namespace detail { namespace vectorize {
+    // Runtime kernels over contiguous sequences of arithmetic values.
+    //
+    // The kernels process the elements in `lanes<T>` independent
+    // accumulators, one per slot of a vector register of
+    // `BOOST_HANA_CONFIG_VECTOR_WIDTH` bytes. The lanes do not depend on
+    // each other, so the inner loops are turned into SIMD instructions by
+    // the optimizer, while the kernels stay usable in constant expressions.
+    // When no vector instruction set is enabled, there is a single lane and
+    // the kernels are plain loops.
+    //
+    // The kernels accept anything whose elements can be accessed with
+    // `xs[i]`, which includes builtin arrays and `std::array`s.
+
+    //! Whether arrays of `T` can be reduced with `sum`, `product`,
+    //! `count_if` and `any_of` kernels.
+    template <typename T>
+    struct can_accumulate
+        : detail::std::is_non_boolean_arithmetic<
+            typename detail::std::remove_cv<T>::type
+        >
+    { };
+
+    //! Whether arrays of `T` can be reduced with `minimum` and `maximum`
+    //! kernels. Only integral types are supported, since grouping the
+    //! comparisons differently could select a different `-0.0` or `NaN`
+    //! for floating point types.
+    template <typename T>
+    struct can_select
+        : detail::std::is_non_boolean_integral<
+            typename detail::std::remove_cv<T>::type
+        >
+    { };
+
+    //! Number of independent lanes used to process elements of type `T`.
+    template <typename T>
+    struct lanes
+        : detail::std::integral_constant<detail::std::size_t,
+            can_accumulate<T>{} && sizeof(T) < BOOST_HANA_CONFIG_VECTOR_WIDTH
+                ? BOOST_HANA_CONFIG_VECTOR_WIDTH / sizeof(T)
+                : 1
+        >
+    { };
+
+    template <typename T>
+    using accumulator_t = decltype(
+        detail::std::declval<T>() + detail::std::declval<T>()
+    );
+
+    //! Returns the sum of the `n > 0` first elements of `xs`.
+    template <typename T, typename Xs>
+    constexpr accumulator_t<T> sum(Xs const& xs, detail::std::size_t n) {
+        constexpr detail::std::size_t L = lanes<T>::value;
+        accumulator_t<T> acc[L] = {};
+        detail::std::size_t i = 0;
+        for (; i + L <= n; i += L)
+            for (detail::std::size_t l = 0; l < L; ++l)
+                acc[l] += xs[i + l];
+        for (detail::std::size_t l = 0; i + l < n; ++l)
+            acc[l] += xs[i + l];
+
+        for (detail::std::size_t l = 1; l < L; ++l)
+            acc[0] += acc[l];
+        return acc[0];
+    }
+
+    //! Returns the product of the `n > 0` first elements of `xs`.
+    template <typename T, typename Xs>
+    constexpr accumulator_t<T> product(Xs const& xs, detail::std::size_t n) {
+        constexpr detail::std::size_t L = lanes<T>::value;
+        accumulator_t<T> acc[L] = {};
+        for (detail::std::size_t l = 0; l < L; ++l)
+            acc[l] = 1;
+        detail::std::size_t i = 0;
+        for (; i + L <= n; i += L)
+            for (detail::std::size_t l = 0; l < L; ++l)
+                acc[l] *= xs[i + l];
+        for (detail::std::size_t l = 0; i + l < n; ++l)
+            acc[l] *= xs[i + l];
+
+        for (detail::std::size_t l = 1; l < L; ++l)
+            acc[0] *= acc[l];
+        return acc[0];
+    }
+
+    struct _min {
+        template <typename T>
+        constexpr T operator()(T x, T y) const
+        { return y < x ? y : x; }
+    };
+
+    struct _max {
+        template <typename T>
+        constexpr T operator()(T x, T y) const
+        { return x < y ? y : x; }
+    };
+
+    //! Returns the element of the `n > 0` first elements of `xs` that is
+    //! kept by repeatedly applying `f`, which must be `_min` or `_max`.
+    template <typename T, typename Xs, typename Select>
+    constexpr typename detail::std::remove_cv<T>::type
+    select(Xs const& xs, detail::std::size_t n, Select f) {
+        using R = typename detail::std::remove_cv<T>::type;
+        constexpr detail::std::size_t L = lanes<T>::value;
+        if (n < L) {
+            R result = xs[0];
+            for (detail::std::size_t i = 1; i < n; ++i)
+                result = f(result, static_cast<R>(xs[i]));
+            return result;
+        }
+
+        R acc[L] = {};
+        for (detail::std::size_t l = 0; l < L; ++l)
+            acc[l] = xs[l];
+        detail::std::size_t i = L;
+        for (; i + L <= n; i += L)
+            for (detail::std::size_t l = 0; l < L; ++l)
+                acc[l] = f(acc[l], static_cast<R>(xs[i + l]));
+        for (detail::std::size_t l = 0; i + l < n; ++l)
+            acc[l] = f(acc[l], static_cast<R>(xs[i + l]));
+
+        for (detail::std::size_t l = 1; l < L; ++l)
+            acc[0] = f(acc[0], acc[l]);
+        return acc[0];
+    }
+
+    //! Returns the number of elements among the `n` first elements of `xs`
+    //! for which `pred` returns a true-valued arithmetic value.
+    template <typename T, typename Xs, typename Pred>
+    constexpr detail::std::size_t
+    count_if(Xs&& xs, detail::std::size_t n, Pred&& pred) {
+        constexpr detail::std::size_t L = lanes<T>::value;
+        detail::std::size_t counts[L] = {};
+        detail::std::size_t i = 0;
+        for (; i + L <= n; i += L)
+            for (detail::std::size_t l = 0; l < L; ++l)
+                counts[l] += pred(xs[i + l]) ? 1 : 0;
+        for (detail::std::size_t l = 0; i + l < n; ++l)
+            counts[l] += pred(xs[i + l]) ? 1 : 0;
+
+        for (detail::std::size_t l = 1; l < L; ++l)
+            counts[0] += counts[l];
+        return counts[0];
+    }
+
+    //! Returns whether `pred` returns a true-valued arithmetic value for
+    //! any element in the range `[from, n)` of `xs`.
+    //!
+    //! The predicate is applied to a whole block of `lanes<T>` elements
+    //! before checking whether one of them satisfied it, so it may be
+    //! called on (at most `lanes<T> - 1`) elements following the first
+    //! element satisfying it.
+    template <typename T, typename Xs, typename Pred>
+    constexpr bool any_of(Xs&& xs, detail::std::size_t from,
+                          detail::std::size_t n, Pred&& pred)
+    {
+        constexpr detail::std::size_t L = lanes<T>::value;
+        detail::std::size_t i = from;
+        for (; i + L <= n; i += L) {
+            bool found = false;
+            for (detail::std::size_t l = 0; l < L; ++l)
+                found |= pred(xs[i + l]) ? true : false;
+            if (found)
+                return true;
+        }
+        for (; i < n; ++i)
+            if (pred(xs[i]))
+                return true;
+        return false;
+    }
+}}}} // end namespace boost::hana::detail::vectorize
+
+#endif // !BOOST_HANA_DETAIL_VECTORIZE_HPP
@@ -16,7 +16,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/forward.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
+#include <boost/hana/searchable.hpp>
 #include <boost/hana/sequence.hpp>
 
 #include <array>
@@ -69,6 +72,113 @@ namespace boost { namespace hana {
         : Iterable::foldr1_impl<ext::std::Array>
     { };
 
+    namespace std_array_detail {
+        template <typename Xs>
+        using raw_t = typename detail::std::remove_reference<Xs>::type;
+
+        template <typename Xs>
+        using is_empty_t = _integral_constant<bool,
+            ::std::tuple_size<raw_t<Xs>>::value == 0
+        >;
+
+        // Builtin array type with the same elements as the `std::array`
+        // `Xs`. Non-empty `std::array`s are reduced and searched like the
+        // corresponding builtin arrays, which use vectorized kernels when
+        // their elements are arithmetic.
+        template <typename Xs>
+        using builtin_t = typename raw_t<Xs>::value_type[
+            ::std::tuple_size<raw_t<Xs>>::value
+        ];
+    }
+
+    template <>
+    struct sum_impl<ext::std::Array> {
+        template <typename Xs>
+        static constexpr decltype(auto) helper(decltype(true_), Xs&& xs) {
+            return sum_impl<ext::std::Array, when<true>>::apply(
+                detail::std::forward<Xs>(xs)
+            );
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) helper(decltype(false_), Xs&& xs) {
+            using Builtin = std_array_detail::builtin_t<Xs>;
+            return sum_impl<Builtin>::apply(detail::std::forward<Xs>(xs));
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return helper(std_array_detail::is_empty_t<Xs>{},
+                          detail::std::forward<Xs>(xs));
+        }
+    };
+
+    template <>
+    struct product_impl<ext::std::Array> {
+        template <typename Xs>
+        static constexpr decltype(auto) helper(decltype(true_), Xs&& xs) {
+            return product_impl<ext::std::Array, when<true>>::apply(
+                detail::std::forward<Xs>(xs)
+            );
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) helper(decltype(false_), Xs&& xs) {
+            using Builtin = std_array_detail::builtin_t<Xs>;
+            return product_impl<Builtin>::apply(detail::std::forward<Xs>(xs));
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return helper(std_array_detail::is_empty_t<Xs>{},
+                          detail::std::forward<Xs>(xs));
+        }
+    };
+
+    template <>
+    struct minimum_impl<ext::std::Array> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using Builtin = std_array_detail::builtin_t<Xs>;
+            return minimum_impl<Builtin>::apply(detail::std::forward<Xs>(xs));
+        }
+    };
+
+    template <>
+    struct maximum_impl<ext::std::Array> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using Builtin = std_array_detail::builtin_t<Xs>;
+            return maximum_impl<Builtin>::apply(detail::std::forward<Xs>(xs));
+        }
+    };
+
+    template <>
+    struct count_if_impl<ext::std::Array> {
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(true_), Xs&& xs, Pred&& pred) {
+            return count_if_impl<ext::std::Array, when<true>>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            return count_if_impl<std_array_detail::builtin_t<Xs>>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return helper(std_array_detail::is_empty_t<Xs>{},
+                          detail::std::forward<Xs>(xs),
+                          detail::std::forward<Pred>(pred));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
@@ -78,9 +188,30 @@ namespace boost { namespace hana {
     { };
 
     template <>
-    struct any_of_impl<ext::std::Array>
-        : Iterable::any_of_impl<ext::std::Array>
-    { };
+    struct any_of_impl<ext::std::Array> {
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(true_), Xs&& xs, Pred&& pred) {
+            return Iterable::any_of_impl<ext::std::Array>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            return any_of_impl<std_array_detail::builtin_t<Xs>>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return helper(std_array_detail::is_empty_t<Xs>{},
+                          detail::std::forward<Xs>(xs),
+                          detail::std::forward<Pred>(pred));
+        }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Iterable
@@ -13,13 +13,17 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/foldable.hpp>
 
 #include <boost/hana/applicative.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/create.hpp>
+#include <boost/hana/detail/std/decay.hpp>
 #include <boost/hana/detail/std/forward.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_arithmetic.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/move.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
@@ -28,6 +32,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/variadic/foldr.hpp>
 #include <boost/hana/detail/variadic/foldr1.hpp>
 #include <boost/hana/detail/variadic/for_each.hpp>
+#include <boost/hana/detail/variadic/tree_fold.hpp>
+#include <boost/hana/detail/vectorize.hpp>
 #include <boost/hana/enumerable.hpp>
 #include <boost/hana/functional/curry.hpp>
 #include <boost/hana/functional/partial.hpp>
@@ -246,6 +252,26 @@ namespace boost { namespace hana {
         : foldable_detail::foldl1_helper<T>, default_
     { };
 
+    //////////////////////////////////////////////////////////////////////////
+    // tree_fold
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename>
+    struct tree_fold_impl : tree_fold_impl<T, when<true>> { };
+
+    // The elements are always reached through `unpack`, whose default
+    // implementation through `foldl` works for any `Foldable`, so that the
+    // grouping of the calls to `f` is the same for every model.
+    template <typename T, bool condition>
+    struct tree_fold_impl<T, when<condition>> : default_ {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return hana::unpack(detail::std::forward<Xs>(xs),
+                hana::partial(detail::variadic::tree_fold,
+                              detail::std::forward<F>(f))
+            );
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // for_each
     //////////////////////////////////////////////////////////////////////////
@@ -382,7 +408,7 @@ namespace boost { namespace hana {
     struct minimum_by_impl<T, when<condition>> : default_ {
         template <typename Pred, typename Xs>
         static constexpr decltype(auto) apply(Pred&& pred, Xs&& xs) {
-            return hana::foldl1(detail::std::forward<Xs>(xs),
+            return hana::tree_fold(detail::std::forward<Xs>(xs),
                 detail::create<foldable_detail::minpred>{}(
                     detail::std::forward<Pred>(pred)
                 )
@@ -444,7 +470,7 @@ namespace boost { namespace hana {
     struct maximum_by_impl<T, when<condition>> : default_ {
         template <typename Pred, typename Xs>
         static constexpr decltype(auto) apply(Pred&& pred, Xs&& xs) {
-            return hana::foldl1(detail::std::forward<Xs>(xs),
+            return hana::tree_fold(detail::std::forward<Xs>(xs),
                 detail::create<foldable_detail::maxpred>{}(
                     detail::std::forward<Pred>(pred)
                 )
@@ -473,10 +499,25 @@ namespace boost { namespace hana {
 
     template <typename T, bool condition>
     struct sum_impl<T, when<condition>> : default_ {
+        using M = IntegralConstant<int>;
+
+        template <typename Xs>
+        static constexpr auto sum_helper(decltype(true_), Xs&&)
+        { return zero<M>(); }
+
+        template <typename Xs>
+        static constexpr decltype(auto) sum_helper(decltype(false_), Xs&& xs) {
+            return hana::plus(zero<M>(),
+                              hana::tree_fold(detail::std::forward<Xs>(xs), plus));
+        }
+
+        // Since `plus` is associative, the elements are added as a balanced
+        // tree to shorten the chain of dependent additions.
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            using M = IntegralConstant<int>;
-            return hana::foldl(detail::std::forward<Xs>(xs), zero<M>(), plus);
+            using Length = decltype(hana::length(xs));
+            return sum_helper(bool_<hana::value<Length>() == 0>,
+                              detail::std::forward<Xs>(xs));
         }
     };
 
@@ -488,10 +529,25 @@ namespace boost { namespace hana {
 
     template <typename T, bool condition>
     struct product_impl<T, when<condition>> : default_ {
+        using R = IntegralConstant<int>;
+
+        template <typename Xs>
+        static constexpr auto product_helper(decltype(true_), Xs&&)
+        { return one<R>(); }
+
+        template <typename Xs>
+        static constexpr decltype(auto) product_helper(decltype(false_), Xs&& xs) {
+            return hana::mult(one<R>(),
+                              hana::tree_fold(detail::std::forward<Xs>(xs), mult));
+        }
+
+        // Like for `sum`, `mult` is associative so the elements are
+        // multiplied as a balanced tree.
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            using R = IntegralConstant<int>;
-            return hana::foldl(detail::std::forward<Xs>(xs), one<R>(), mult);
+            using Length = decltype(hana::length(xs));
+            return product_helper(bool_<hana::value<Length>() == 0>,
+                                  detail::std::forward<Xs>(xs));
         }
     };
 
@@ -607,6 +663,68 @@ namespace boost { namespace hana {
             );
         }
     };
+
+    // The reductions below are done at runtime by the kernels in
+    // `detail::vectorize` for arrays of arithmetic types, which would
+    // otherwise be unpacked and reduced with one function call per element.
+    template <typename T, detail::std::size_t N>
+    struct sum_impl<T[N], when<detail::vectorize::can_accumulate<T>{}>> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs const& xs) {
+            return hana::plus(zero<IntegralConstant<int>>(),
+                              detail::vectorize::sum<T>(xs, N));
+        }
+    };
+
+    template <typename T, detail::std::size_t N>
+    struct product_impl<T[N], when<detail::vectorize::can_accumulate<T>{}>> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs const& xs) {
+            return hana::mult(one<IntegralConstant<int>>(),
+                              detail::vectorize::product<T>(xs, N));
+        }
+    };
+
+    template <typename T, detail::std::size_t N>
+    struct minimum_impl<T[N], when<detail::vectorize::can_select<T>{}>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return detail::vectorize::select<T>(xs, N, detail::vectorize::_min{}); }
+    };
+
+    template <typename T, detail::std::size_t N>
+    struct maximum_impl<T[N], when<detail::vectorize::can_select<T>{}>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs)
+        { return detail::vectorize::select<T>(xs, N, detail::vectorize::_max{}); }
+    };
+
+    template <typename T, detail::std::size_t N>
+    struct count_if_impl<T[N], when<detail::vectorize::can_accumulate<T>{}>> {
+        template <typename Xs, typename Pred>
+        static constexpr auto count_if_helper(decltype(true_), Xs&& xs, Pred&& pred)
+        { return detail::vectorize::count_if<T>(xs, N, pred); }
+
+        // If the predicate returns a `Constant` (or anything else than an
+        // arithmetic value), the count is computed like for other Foldables.
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        count_if_helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            return hana::foldl(detail::std::forward<Xs>(xs), size_t<0>,
+                detail::create<foldable_detail::countpred>{}(
+                    detail::std::forward<Pred>(pred)
+                )
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            using Cond = typename detail::std::decay<decltype(pred(xs[0]))>::type;
+            return count_if_helper(bool_<detail::std::is_arithmetic<Cond>{}>,
+                                   detail::std::forward<Xs>(xs),
+                                   detail::std::forward<Pred>(pred));
+        }
+    };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FOLDABLE_HPP
@@ -98,18 +98,18 @@ namespace boost { namespace hana {
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) const& {
-            return f(static_cast<G const&>(g).get(x...)...);
+            return f(static_cast<G const&>(g).get()(x...)...);
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) & {
-            return f(static_cast<G&>(g).get(x...)...);
+            return f(static_cast<G&>(g).get()(x...)...);
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) && {
             // Not moving from G cause we would double-move.
-            return detail::std::move(f)(static_cast<G&>(g).get(x...)...);
+            return detail::std::move(f)(static_cast<G&>(g).get()(x...)...);
         }
     };
 
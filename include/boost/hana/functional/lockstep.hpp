@@ -51,17 +51,17 @@ namespace boost { namespace hana {
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) const& {
-            return f(static_cast<G const&>(g).get(detail::std::forward<X>(x))...);
+            return f(static_cast<G const&>(g).get()(detail::std::forward<X>(x))...);
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) & {
-            return f(static_cast<G&>(g).get(detail::std::forward<X>(x))...);
+            return f(static_cast<G&>(g).get()(detail::std::forward<X>(x))...);
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) && {
-            return f(static_cast<G&&>(g).get(detail::std::forward<X>(x))...);
+            return f(static_cast<G&&>(g).get()(detail::std::forward<X>(x))...);
         }
     };
 
@@ -47,18 +47,18 @@ namespace boost { namespace hana {
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) const& {
-            return f(static_cast<X const&>(x).get..., detail::std::forward<Y>(y)...);
+            return f(static_cast<X const&>(x).get()..., detail::std::forward<Y>(y)...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) & {
-            return f(static_cast<X&>(x).get..., detail::std::forward<Y>(y)...);
+            return f(static_cast<X&>(x).get()..., detail::std::forward<Y>(y)...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) && {
             return detail::std::move(f)(
-                static_cast<X&&>(x).get..., detail::std::forward<Y>(y)...
+                static_cast<X&&>(x).get()..., detail::std::forward<Y>(y)...
             );
         }
     };
@@ -99,22 +99,22 @@ namespace boost { namespace hana {
             constexpr auto operator()(F&& f, Z const& ...) const&
                 -> decltype(detail::std::forward<F>(f)(static_cast<X const&>(
                     detail::std::declval<detail::closure_impl<X...>>()
-                ).get...))
-            { return detail::std::forward<F>(f)(static_cast<X const&>(x).get...); }
+                ).get()...))
+            { return detail::std::forward<F>(f)(static_cast<X const&>(x).get()...); }
 
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) &
                 -> decltype(detail::std::forward<F>(f)(static_cast<X&>(
                     detail::std::declval<detail::closure_impl<X...>&>()
-                ).get...))
-            { return detail::std::forward<F>(f)(static_cast<X&>(x).get...); }
+                ).get()...))
+            { return detail::std::forward<F>(f)(static_cast<X&>(x).get()...); }
 
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) &&
                 -> decltype(detail::std::forward<F>(f)(static_cast<X&&>(
                     detail::std::declval<detail::closure_impl<X...>>()
-                ).get...))
-            { return detail::std::forward<F>(f)(static_cast<X&&>(x).get...); }
+                ).get()...))
+            { return detail::std::forward<F>(f)(static_cast<X&&>(x).get()...); }
         };
 
         struct placeholder {
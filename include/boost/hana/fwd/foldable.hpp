@@ -66,7 +66,11 @@ namespace boost { namespace hana {
     //! Builtin arrays whose size is known can be folded as-if they were
     //! homogeneous tuples. However, note that builtin arrays can't be
     //! made more than `Foldable` (e.g. `Iterable`) because they can't
-    //! be empty and they also can't be returned from functions.
+    //! be empty and they also can't be returned from functions. When the
+    //! elements are arithmetic, `sum`, `product`, `count` and `count_if`
+    //! (with a predicate returning an arithmetic value), as well as
+    //! `minimum` and `maximum` for integral elements, are computed by loops
+    //! that can be vectorized; see @ref BOOST_HANA_CONFIG_VECTOR_WIDTH.
     //!
     //!
     //! @todo
@@ -377,6 +381,71 @@ namespace boost { namespace hana {
     constexpr _foldl1 foldl1{};
 #endif
 
+    //! Variant of `foldl1` for associative functions, grouping the elements
+    //! as a balanced binary tree.
+    //! @relates Foldable
+    //!
+    //! Given a non-empty structure with elements `x1, ..., xn` and an
+    //! associative binary function `f`, `tree_fold(foldable, f)` is equal
+    //! to `foldl1(foldable, f)`, but `f` is applied to pairs of adjacent
+    //! elements, then to pairs of the results, and so on. Specifically,
+    //! the left subtree of every node holds the largest power of two of
+    //! elements smaller than the number of elements of that node, so that
+    //! @code
+    //!     tree_fold([x1, ..., x5], f) == f(f(f(x1, x2), f(x3, x4)), x5)
+    //! @endcode
+    //! Every model of `Foldable` folds with this grouping, since the
+    //! elements are passed to the tree through `unpack` by default; models
+    //! providing their own `tree_fold` must preserve it.
+    //!
+    //! Since the calls at a given level of the tree do not depend on each
+    //! other, the longest chain of dependent calls to `f` has a length
+    //! logarithmic in the number of elements instead of linear, which
+    //! lets the processor evaluate independent calls in parallel. Also,
+    //! the depth of the template instantiations is logarithmic instead of
+    //! linear, and floating point roundoff errors tend to accumulate more
+    //! slowly than with a left fold. `sum`, `product`, `minimum_by` and
+    //! `maximum_by` use `tree_fold` by default.
+    //!
+    //!
+    //! @param foldable
+    //! The structure to fold.
+    //!
+    //! @param f
+    //! An associative binary function called as `f(x, y)`, where `x` and
+    //! `y` are adjacent elements of the structure or results of previous
+    //! calls to `f`. The order in which independent calls to `f` are made
+    //! is unspecified.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/foldable.cpp tree_fold
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto tree_fold = [](auto&& foldable, auto&& f) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename Xs, typename = void>
+    struct tree_fold_impl;
+
+    struct _tree_fold {
+        template <typename Xs, typename F>
+        constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
+#ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
+            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            "hana::tree_fold(xs, f) requires xs to be Foldable");
+#endif
+            return tree_fold_impl<typename datatype<Xs>::type>::apply(
+                detail::std::forward<Xs>(xs),
+                detail::std::forward<F>(f)
+            );
+        }
+    };
+
+    constexpr _tree_fold tree_fold{};
+#endif
+
     //! Equivalent to `fold` in Boost.Fusion and Boost.MPL.
     //! @relates Foldable
     //!
@@ -0,0 +1,65 @@
+/*!
+@file
+Forward declares `boost::hana::hash`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_HASH_HPP
+#define BOOST_HANA_FWD_HASH_HPP
+
+#include <boost/hana/fwd/core/datatype.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-core
+    //! Returns a hash value of an object.
+    //!
+    //! `hash(x)` returns a value convertible to `std::size_t` such that
+    //! equal objects of the same type have equal hash values. Its type,
+    //! `decltype(hash)` with its qualifiers removed, is a default
+    //! constructible function object which can be used as the hash
+    //! function of unordered containers.
+    //!
+    //! The hash value of an object depends on its data type:
+    //! 1. For a `String` or a `Constant` holding an integral value, it is
+    //!    computed at compile-time and returned as an `IntegralConstant`.
+    //! 2. For a `Record`, a `Tuple` or a `Pair`, it combines the hash values
+    //!    of its members, in order. However, when the object is trivially
+    //!    copyable and its members are integral or enumeration values (or
+    //!    such objects, recursively) covering all its bytes, i.e. when two
+    //!    objects are equal if and only if their bytes are equal, the bytes
+    //!    of the object are hashed at once instead.
+    //! 3. For integral and enumeration values, it is a hash of its bytes.
+    //! 4. For any other object, it is `std::hash<X>{}(x)`.
+    //!
+    //! `hash` is tag-dispatched on the data type of `x`, so `hash_impl` may
+    //! be specialized to hash other data types.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/hash.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto hash = [](auto const& x) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct hash_impl;
+
+    struct _hash {
+        template <typename X>
+        constexpr decltype(auto) operator()(X const& x) const {
+            using T = typename datatype<X>::type;
+            return hash_impl<T>::apply(x);
+        }
+    };
+
+    constexpr _hash hash{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_HASH_HPP
@@ -0,0 +1,139 @@
+/*!
+@file
+Forward declares `boost::hana::HomogeneousTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_HOMOGENEOUS_TUPLE_HPP
+#define BOOST_HANA_FWD_HOMOGENEOUS_TUPLE_HPP
+
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/core/make.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Fixed-size sequence of objects which all have the same type.
+    //!
+    //! A `HomogeneousTuple` is like a `Tuple` whose elements are all of the
+    //! same type, except that the elements are stored contiguously in an
+    //! array. Since the type of the elements does not change from one index
+    //! to the next, most algorithms are implemented as plain runtime loops
+    //! instead of recursive template instantiations, which is much cheaper
+    //! to compile and lets the compiler optimize the loops like it would
+    //! for a built-in array.
+    //!
+    //! Note that the number of elements of a `HomogeneousTuple` is still
+    //! known at compile-time, so `length` and `is_empty` return `Constant`s
+    //! like they do for a `Tuple`.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Comparable` (operators provided)\n
+    //! Two homogeneous tuples are equal if and only if they have the same
+    //! number of elements and their elements are equal at every index.
+    //! Homogeneous tuples of different lengths are never equal, which is
+    //! known at compile-time.
+    //! @snippet example/homogeneous_tuple.cpp comparable
+    //!
+    //! 2. `Orderable` (operators provided)\n
+    //! Homogeneous tuples are ordered lexicographically, like `Tuple`s.
+    //! @snippet example/homogeneous_tuple.cpp orderable
+    //!
+    //! 3. `Functor`\n
+    //! Transforming a `HomogeneousTuple` with a function `f` creates a new
+    //! `HomogeneousTuple` holding the results of `f`, which must all have
+    //! the same type.
+    //! @snippet example/homogeneous_tuple.cpp functor
+    //!
+    //! 4. `Foldable`\n
+    //! Folding a `HomogeneousTuple` is equivalent to folding a `Tuple` with
+    //! the same elements. As soon as the function returns a state with the
+    //! same type as the previous one, the remaining elements are folded
+    //! with a runtime loop.
+    //! @snippet example/homogeneous_tuple.cpp foldable
+    //!
+    //! 5. `Iterable` (operators provided)\n
+    //! Iterating over a `HomogeneousTuple` is equivalent to iterating over
+    //! a `Tuple` with the same elements. In particular, `xs[n]` can be used
+    //! with a runtime index `n`.
+    //! @snippet example/homogeneous_tuple.cpp iterable
+    //!
+    //! 6. `Searchable`\n
+    //! Searching a `HomogeneousTuple` is equivalent to searching a `Tuple`
+    //! with the same elements. However, since the predicate is called with
+    //! arguments of the same type, `find_if` can only be used with predicates
+    //! returning a `Constant`, in which case the result is the first element
+    //! or `nothing`. `any_of` also accepts predicates returning a runtime
+    //! `Logical`, in which case it returns a `bool`.
+    //! @snippet example/homogeneous_tuple.cpp searchable
+    //!
+    //! 7. `Monoid`, `Group` and `Ring` (operators provided)\n
+    //! Homogeneous tuples of the same length are added, subtracted and
+    //! multiplied element-wise, and `negate` negates every element. For
+    //! arithmetic elements, this compiles to vector instructions. Like for
+    //! `Tuple`, there is no `zero<HomogeneousTuple>()` or
+    //! `one<HomogeneousTuple>()`, since the length is not part of the data
+    //! type.
+    //! @snippet example/homogeneous_tuple.cpp arithmetic
+    //!
+    //!
+    //! Conversion from and to `Tuple`
+    //! ------------------------------
+    //! A `HomogeneousTuple` can be converted to a `Tuple` holding the same
+    //! elements, and a `Tuple` whose elements all have the same type can be
+    //! converted to a `HomogeneousTuple`.
+    //! @snippet example/homogeneous_tuple.cpp conversions
+    struct HomogeneousTuple { };
+
+    template <typename T, detail::std::size_t n>
+    struct _homogeneous_tuple;
+
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    //! Creates a `HomogeneousTuple` holding the given objects.
+    //! @relates HomogeneousTuple
+    //!
+    //! At least one object must be given, and all the objects must have the
+    //! same type once their references and cv-qualifiers are stripped.
+    //! Otherwise, a compilation error is triggered. The objects are copied
+    //! or moved into the resulting homogeneous tuple. Since the type of the
+    //! elements is deduced from the objects, empty homogeneous tuples are
+    //! created with `empty_homogeneous_tuple<T>` instead.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/homogeneous_tuple.cpp make<HomogeneousTuple>
+    template <>
+    constexpr auto make<HomogeneousTuple> = [](auto&& x, auto&& ...xs) {
+        return unspecified-type;
+    };
+#endif
+
+    //! Alias to `make<HomogeneousTuple>`; provided for convenience.
+    //! @relates HomogeneousTuple
+    constexpr auto homogeneous_tuple = make<HomogeneousTuple>;
+
+    //! An empty `HomogeneousTuple` of elements of type `T`.
+    //! @relates HomogeneousTuple
+    //!
+    //! `T` does not have to be default constructible.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/homogeneous_tuple.cpp empty_homogeneous_tuple
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename T>
+    constexpr unspecified-type empty_homogeneous_tuple{};
+#else
+    template <typename T>
+    constexpr _homogeneous_tuple<T, 0> empty_homogeneous_tuple{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_HOMOGENEOUS_TUPLE_HPP
@@ -139,6 +139,13 @@ namespace boost { namespace hana {
     //! To take advantage of this operator for a type `T`, `T` must inherit
     //! `hana::operators::Iterable_ops<T>`.
     //!
+    //! When `n` is a built-in integer instead of a `Constant`, `xs[n]` is
+    //! the `n`-th element of `xs` selected at runtime through `visit_at`.
+    //! In that case, all the elements of `xs` must have the same type and,
+    //! like with `std::array::operator[]`, the behavior is undefined when
+    //! `n` is not a valid index. `visit_at` can be used instead when the
+    //! index must be checked.
+    //!
     //!
     //! @todo
     //! - Add perfect forwarding in the methods.
@@ -226,6 +233,46 @@ namespace boost { namespace hana {
     constexpr _tail tail{};
 #endif
 
+    //! Returns the first element of a non-empty iterable along with the
+    //! other elements.
+    //! @relates Iterable
+    //!
+    //! Given a non-empty Iterable `xs`, `uncons(xs)` is a `Pair` equivalent
+    //! to `pair(head(xs), tail(xs))`. However, `uncons` forwards `xs` to
+    //! both `head` and `tail`, taking out the head of `xs` before its tail.
+    //! Hence, when `xs` is an rvalue, its elements are moved into the result
+    //! instead of being copied, which makes it possible for a recursive
+    //! algorithm to pass its remaining elements from one step to the next
+    //! without copying them.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/iterable.cpp uncons
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto uncons = [](auto&& iterable) {
+        return tag-dispatched;
+    };
+#else
+    template <typename Xs, typename = void>
+    struct uncons_impl;
+
+    struct _uncons {
+        template <typename Xs>
+        constexpr decltype(auto) operator()(Xs&& xs) const {
+#ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
+            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            "hana::uncons(xs) requires xs to be an Iterable");
+#endif
+            return uncons_impl<typename datatype<Xs>::type>::apply(
+                detail::std::forward<Xs>(xs)
+            );
+        }
+    };
+
+    constexpr _uncons uncons{};
+#endif
+
     //! Returns whether the iterable is empty.
     //! @relates Iterable
     //!
@@ -334,6 +381,62 @@ namespace boost { namespace hana {
     constexpr _at_c<n> at_c{};
 #endif
 
+    //! Calls a function on the element of a finite iterable at an index
+    //! known at runtime.
+    //! @relates Iterable
+    //!
+    //! Given an index `i` known at runtime, a finite iterable `xs` with a
+    //! linearization of `[x0, ..., xN-1]` and a function `f`,
+    //! `visit_at(i, xs, f)` calls `f(xi)` and returns `true` if `i < N`.
+    //! Otherwise, `f` is not called and `false` is returned. `f` must be
+    //! callable with every element of the iterable, and the result of `f`
+    //! is ignored.
+    //!
+    //! For `Tuple`s, the element is selected through a table of functions
+    //! indexed by `i`, so the cost of `visit_at` does not depend on the
+    //! number of elements.
+    //!
+    //!
+    //! @param i
+    //! A non-negative integer representing the 0-based index of the element
+    //! to visit. Unlike `at`, this index does not need to be a `Constant`.
+    //!
+    //! @param iterable
+    //! The iterable whose `i`-th element is visited.
+    //!
+    //! @param f
+    //! A function called as `f(xi)` if `i` is a valid index.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/iterable.cpp visit_at
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_at = [](std::size_t i, auto&& iterable, auto&& f) {
+        return tag-dispatched;
+    };
+#else
+    template <typename Xs, typename = void>
+    struct visit_at_impl;
+
+    struct _visit_at {
+        template <typename Xs, typename F>
+        bool operator()(detail::std::size_t i, Xs&& xs, F&& f) const {
+#ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
+            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            "hana::visit_at(i, xs, f) requires xs to be an Iterable");
+#endif
+            return visit_at_impl<typename datatype<Xs>::type>::apply(
+                i,
+                detail::std::forward<Xs>(xs),
+                detail::std::forward<F>(f)
+            );
+        }
+    };
+
+    constexpr _visit_at visit_at{};
+#endif
+
     //! Returns the last element of a non-empty and finite iterable.
     //! @relates Iterable
     //!
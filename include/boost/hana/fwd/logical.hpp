@@ -344,6 +344,11 @@ namespace boost { namespace hana {
     //! where `f` is iterated as long as `pred(f(...))` is a true-valued
     //! `Logical`.
     //!
+    //! When `pred` returns a runtime `Logical` and `f` returns a state of
+    //! the same type as its argument, the default implementation for
+    //! built-in types iterates in a plain loop, so the number of iterations
+    //! is not limited by the size of the stack.
+    //!
     //!
     //! @param pred
     //! A predicate called on the state or on the result of applying `f` a
@@ -404,6 +409,8 @@ namespace boost { namespace hana {
     //!     f(...f(f(state)))
     //! @endcode
     //! where `f` is iterated until `pred(f(...))` is a true-valued `Logical`.
+    //! Like for `while_`, this is done in a plain loop when `pred` returns
+    //! a runtime `Logical` and the type of the state does not change.
     //!
     //!
     //! @param pred
@@ -31,7 +31,9 @@ namespace boost { namespace hana {
     //!
     //! 2. `Searchable`\n
     //! A map can be searched by its keys with a predicate yielding a
-    //! compile-time `Logical`.
+    //! compile-time `Logical`. When looking up a key with `find` or `elem`,
+    //! a key of the map with exactly the same type is found without being
+    //! compared to the other keys.
     //! @snippet example/map.cpp searchable
     //!
     //!
@@ -112,6 +114,43 @@ namespace boost { namespace hana {
 
     constexpr _values values{};
 #endif
+
+    //! Returns a function object looking up the values of a map with
+    //! `String` keys from strings known at runtime.
+    //! @relates Map
+    //!
+    //! Given a `Map` whose keys are all compile-time `String`s,
+    //! `frozen_lookup(map)` returns a function object `lookup` holding a
+    //! copy of the map. `lookup(str, length, f)` calls `f` with the value
+    //! associated to the key equal to the `length` characters pointed to
+    //! by `str`, and returns `true`. If there is no such key, `f` is not
+    //! called and `false` is returned. `lookup(str, f)` is equivalent for
+    //! a null-terminated string.
+    //!
+    //! A perfect hash function of the keys is computed at compile-time.
+    //! Hence, looking up a string only requires hashing it once, comparing
+    //! it with a single key and calling `f` through a table of functions;
+    //! no memory is allocated.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/map.cpp frozen_lookup
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto frozen_lookup = [](auto&& map) {
+        return unspecified-type;
+    };
+#else
+    template <typename Map>
+    struct _frozen_lookup;
+
+    struct _frozen_lookup_fn {
+        template <typename Map>
+        constexpr auto operator()(Map&& map) const;
+    };
+
+    constexpr _frozen_lookup_fn frozen_lookup{};
+#endif
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_MAP_HPP
@@ -81,6 +81,18 @@ namespace boost { namespace hana {
     //! 1. `less`\n
     //! When `less` is defined, the other methods are defined from it using
     //! the same definition as mandated in the laws above.
+    //! 2. `compare`\n
+    //! Lexicographical orders are best defined with `compare`, which
+    //! compares the elements only once each and stops at the first
+    //! difference. `less` may then be defined from `compare` by inheriting
+    //! `Orderable::less_impl` in your definition of `less_impl`:
+    //! @code
+    //!     template <>
+    //!     struct less_impl<YourType, YourType>
+    //!         : Orderable::less_impl<YourType, YourType>
+    //!     { };
+    //! @endcode
+    //! This is how `Tuple`s, `String`s and `Record`s are ordered.
     //!
     //!
     //! Provided models
@@ -210,6 +222,9 @@ namespace boost { namespace hana {
     struct Orderable {
         template <typename T, typename U>
         struct equal_impl;
+
+        template <typename T, typename U>
+        struct less_impl;
     };
 
     //! Returns a `Logical` representing whether `x` is less than `y`.
@@ -473,6 +488,64 @@ namespace boost { namespace hana {
     constexpr _max max{};
 #endif
 
+    //! Returns a negative, zero or positive integer according to whether
+    //! `x` is less than, equivalent to or greater than `y`.
+    //! @relates Orderable
+    //!
+    //! `compare` is a three-way comparison: the result of `less(x, y)` and
+    //! of the other `Orderable` methods can be obtained from a single call
+    //! to `compare(x, y)`, which is what makes it useful for lexicographical
+    //! orders. For example, `Tuple`s are compared by comparing their
+    //! elements in order with `compare`, until one of them is not
+    //! equivalent to the other. Specifically,
+    //! @code
+    //!     less(x, y)     if and only if  compare(x, y) <  0
+    //!     less(y, x)     if and only if  compare(x, y) >  0
+    //!     neither        if and only if  compare(x, y) == 0
+    //! @endcode
+    //!
+    //! When `less(x, y)` and `less(y, x)` are both `Constant`s, the result
+    //! is an `IntegralConstant` holding `-1`, `0` or `1`. Otherwise, it is
+    //! an `int` holding one of these values. By default, `compare` is
+    //! defined from `less`, but it may be defined directly for data types
+    //! whose objects can be compared more efficiently in a single step.
+    //!
+    //!
+    //! Signature
+    //! ---------
+    //! Given two Orderables `A` and `B` with a common embedding, the
+    //! signature is @f$ \mathrm{compare} : A \times B \to int @f$.
+    //!
+    //! @param x, y
+    //! Two objects to compare.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/orderable.cpp compare
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto compare = [](auto&& x, auto&& y) -> decltype(auto) {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename U, typename = void>
+    struct compare_impl;
+
+    struct _compare {
+        template <typename X, typename Y>
+        constexpr decltype(auto) operator()(X&& x, Y&& y) const {
+            return compare_impl<
+                typename datatype<X>::type, typename datatype<Y>::type
+            >::apply(
+                detail::std::forward<X>(x),
+                detail::std::forward<Y>(y)
+            );
+        }
+    };
+
+    constexpr _compare compare{};
+#endif
+
     //! Returns a function performing `less` after applying a transformation
     //! to both arguments.
     //! @relates Orderable
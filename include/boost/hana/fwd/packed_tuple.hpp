@@ -0,0 +1,74 @@
+/*!
+@file
+Forward declares `boost::hana::PackedTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_PACKED_TUPLE_HPP
+#define BOOST_HANA_FWD_PACKED_TUPLE_HPP
+
+#include <boost/hana/fwd/core/make.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Tuple whose elements are laid out in memory so as to minimize padding.
+    //!
+    //! A `Tuple` stores its elements in the order in which they are given,
+    //! so a `Tuple` holding a `char`, a `double`, a `char`, a `double` and
+    //! a `bool` usually requires padding after each of the `char`s and the
+    //! `bool`. A `PackedTuple` instead stores its elements sorted by
+    //! decreasing alignment, which puts the elements requiring the same
+    //! alignment next to each other. The storage order is computed at
+    //! compile-time with a stable sort, so it only depends on the types of
+    //! the elements.
+    //!
+    //! The storage order is an implementation detail: the elements of a
+    //! `PackedTuple` are accessed, unpacked and iterated over in the order
+    //! in which they were given, exactly like for a `Tuple`. Only the size
+    //! of the object and the addresses of its elements differ.
+    //! @snippet example/packed_tuple.cpp layout
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! `Sequence`, and all its superclasses. A `PackedTuple` can be
+    //! converted to and from any other `Sequence` with `to`.
+    //! @snippet example/packed_tuple.cpp sequence
+    //!
+    //!
+    //! Provided operators
+    //! ------------------
+    //! For convenience, operators for methods of the following concepts can
+    //! be used with `PackedTuple`: `Comparable`, `Orderable`, `Iterable`.
+    struct PackedTuple { };
+
+    template <typename ...Xs>
+    struct _packed_tuple;
+
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    //! Creates a `PackedTuple` holding the given objects.
+    //! @relates PackedTuple
+    //!
+    //! The objects are copied or moved into the resulting packed tuple,
+    //! like for `make<Tuple>`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/packed_tuple.cpp make<PackedTuple>
+    template <>
+    constexpr auto make<PackedTuple> = [](auto&& ...xs) {
+        return _packed_tuple<decayed(decltype(xs))...>{unspecified};
+    };
+#endif
+
+    //! Alias to `make<PackedTuple>`; provided for convenience.
+    //! @relates PackedTuple
+    constexpr auto packed_tuple = make<PackedTuple>;
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_PACKED_TUPLE_HPP
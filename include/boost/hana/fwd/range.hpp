@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/fwd/core/make.hpp>
 #include <boost/hana/fwd/integral_constant.hpp>
+#include <boost/hana/fwd/tuple.hpp>
 
 
 namespace boost { namespace hana {
@@ -133,6 +134,53 @@ namespace boost { namespace hana {
         make<Range>(integral_constant<T, from>, integral_constant<T, to>)
     ) range_c{};
 #endif
+
+    //! Calls a function with the `Constant`s of one or more `Range`s that
+    //! are equal to values known at runtime.
+    //! @relates Range
+    //!
+    //! Given a `Range` `r`, a value `v` known at runtime and a function `f`,
+    //! `dispatch(r, v, f)` calls `f(c)` and returns `true`, where `c` is the
+    //! `Constant` of `r` whose value is equal to `v`. If `r` contains no
+    //! such `Constant`, `f` is not called and `false` is returned. `v` is
+    //! compared with the bounds of `r` by value, and only converted to the
+    //! underlying integral type of `r` once it is known to be in `r`. Hence,
+    //! a value which can't be represented by that type is never found. The
+    //! result of `f` is ignored.
+    //!
+    //! Several ranges can be dispatched on at once by passing a `Tuple` of
+    //! ranges and a `Tuple` of values of the same length, in which case
+    //! `f` is called with one `Constant` of each range:
+    //! @code
+    //!     dispatch(make<Tuple>(r1, ..., rn), make<Tuple>(v1, ..., vn), f)
+    //! @endcode
+    //! The cartesian product of the ranges is computed at compile-time, and
+    //! `f` is called through a table of functions holding one entry per
+    //! combination of `Constant`s. Hence, dispatching only requires to
+    //! check the bounds of each value and to make a single indirect call,
+    //! regardless of the number and the size of the ranges.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/range.cpp dispatch
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto dispatch = [](auto&& ranges, auto&& values, auto&& f) {
+        return a bool;
+    };
+#else
+    struct _dispatch {
+        template <typename C, typename C::value_type from,
+                              typename C::value_type to,
+                  typename V, typename F>
+        bool operator()(_range<C, from, to> const&, V const&, F&&) const;
+
+        template <typename ...R, typename ...V, typename F>
+        bool operator()(_tuple<R...> const&, _tuple<V...> const&, F&&) const;
+    };
+
+    constexpr _dispatch dispatch{};
+#endif
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_RANGE_HPP
@@ -11,6 +11,8 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_FWD_RECORD_HPP
 
 #include <boost/hana/config.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/fwd/core/models.hpp>
 
 
@@ -123,6 +125,55 @@ namespace boost { namespace hana {
     template <typename R>
     constexpr _members<R> members{};
 #endif
+
+    //! Calls a function with the member of a `Record` whose name is only
+    //! known at runtime.
+    //! @relates Record
+    //!
+    //! Given a `Record` `r` whose keys are all compile-time `String`s,
+    //! `visit_member(r, str, length, f)` calls `f` with the member of `r`
+    //! whose key is equal to the `length` characters pointed to by `str`,
+    //! and returns `true`. If there is no such member, `f` is not called
+    //! and `false` is returned. The member is accessed as specified by the
+    //! accessors of the `Record`, so `f` receives a reference to the member
+    //! of `r` when `r` is an lvalue. `f` must be callable with each member
+    //! of the `Record`.
+    //!
+    //! The name may also be given as a null-terminated string, or as any
+    //! object `name` with `name.data()` and `name.size()` members, such as
+    //! a `std::string` or a `std::string_view`.
+    //!
+    //! Like for `frozen_lookup`, a perfect hash function of the keys is
+    //! computed at compile-time. Hence, looking up a member only requires
+    //! hashing the name once, comparing it with a single key and calling
+    //! `f` through a table of functions; no memory is allocated.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @include example/record.visit_member.cpp
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto visit_member = [](auto&& r, auto const& name, auto&& f) -> bool {
+        return unspecified;
+    };
+#else
+    struct _visit_member {
+        template <typename R, typename F>
+        bool operator()(R&& r, char const* str,
+                        detail::std::size_t length, F&& f) const;
+
+        template <typename R, typename F>
+        bool operator()(R&& r, char const* str, F&& f) const;
+
+        template <typename R, typename Name, typename F, typename = decltype(
+            (void)detail::std::declval<Name const&>().data(),
+            (void)detail::std::declval<Name const&>().size()
+        )>
+        bool operator()(R&& r, Name const& name, F&& f) const;
+    };
+
+    constexpr _visit_member visit_member{};
+#endif
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_RECORD_HPP
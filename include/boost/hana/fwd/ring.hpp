@@ -201,11 +201,19 @@ namespace boost { namespace hana {
     //! itself `n` times using the `Ring` multiplication. If the power is
     //! equal to `zero`, the `Ring` identity (`one`) is returned.
     //!
+    //! The default implementation uses exponentiation by squaring, so
+    //! that only O(log n) multiplications are performed. When `n` is a
+    //! `Constant`, this also means O(log n) template instantiations.
+    //!
+    //!
     //! @param r
     //! A `Ring` element that is elevated to its `n`th power.
     //!
     //! @param n
-    //! An integral `Constant` representing the power to which `r` is elevated.
+    //! A non-negative integral `Constant` or integer representing the power
+    //! to which `r` is elevated. When `n` is not a `Constant`, multiplying
+    //! two elements of the same type as `r` must yield an element of that
+    //! same type.
     //!
     //!
     //! @note
@@ -98,7 +98,10 @@ namespace boost { namespace hana {
     //! homogeneous tuples. However, since arrays can only hold objects of
     //! a single type and the predicate to `find_if` must return a compile-time
     //! Logical, the `find_if` method is fairly useless. For similar reasons,
-    //! the `find` method is also fairly useless.
+    //! the `find` method is also fairly useless. When the elements are
+    //! arithmetic and the predicate returns a runtime value, `any_of` and
+    //! friends search the array in blocks that can be vectorized; see
+    //! @ref BOOST_HANA_CONFIG_VECTOR_WIDTH.
     //!
     //!
     //! @note
@@ -0,0 +1,159 @@
+/*!
+@file
+Forward declares `boost::hana::serialize`, `boost::hana::deserialize` and
+`boost::hana::serialized_size`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_SERIALIZATION_HPP
+#define BOOST_HANA_FWD_SERIALIZATION_HPP
+
+#include <boost/hana/fwd/core/datatype.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-core
+    //! Writes the binary representation of an object to a buffer.
+    //!
+    //! Given an object `x` and a pointer `out` to at least
+    //! `serialized_size(x)` writable bytes, `serialize(x, out)` writes the
+    //! binary representation of `x` to `out` and returns a pointer past the
+    //! last written byte. No memory is allocated.
+    //!
+    //! The binary representation of an object depends on its data type:
+    //! 1. For a `Record`, it is the concatenation of the representations of
+    //!    its members, in the order of `members<R>()`.
+    //! 2. For a `Tuple`, it is the concatenation of the representations of
+    //!    its elements.
+    //! 3. For a `std::vector`, it is the number of elements as an
+    //!    `unsigned long long`, followed by the concatenation of the
+    //!    representations of its elements.
+    //! 4. For an empty object, such as a `Constant` or a compile-time
+    //!    `String`, it is empty.
+    //! 5. For any other trivially copyable object, it is the object
+    //!    representation of the object, i.e. its `sizeof(x)` bytes.
+    //!
+    //! The representation uses the byte order of the machine, and there is
+    //! no padding between the representations of the members of a `Record`
+    //! or the elements of a `Tuple`. However, members which are adjacent in
+    //! memory and whose representation is their object representation are
+    //! written with a single `memcpy`, which makes `serialize` as fast as
+    //! a hand-written encoder.
+    //!
+    //! `serialize` is tag-dispatched on the data type of `x`, so
+    //! `serialize_impl`, `serialized_size_impl` and `deserialize_impl` may
+    //! be specialized together to serialize other data types.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/serialization.cpp serialize
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto serialize = [](auto const& x, char* out) -> char* {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct serialize_impl;
+
+    struct _serialize {
+        template <typename X>
+        char* operator()(X const& x, char* out) const {
+            using T = typename datatype<X>::type;
+            return serialize_impl<T>::apply(x, out);
+        }
+    };
+
+    constexpr _serialize serialize{};
+#endif
+
+    //! @ingroup group-core
+    //! Returns the number of bytes written by `serialize` for an object.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/serialization.cpp serialize
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto serialized_size = [](auto const& x) -> std::size_t {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct serialized_size_impl;
+
+    struct _serialized_size {
+        template <typename X>
+        decltype(auto) operator()(X const& x) const {
+            using T = typename datatype<X>::type;
+            return serialized_size_impl<T>::apply(x);
+        }
+    };
+
+    constexpr _serialized_size serialized_size{};
+#endif
+
+    //! @ingroup group-core
+    //! Creates an object from the binary representation written by
+    //! `serialize`.
+    //!
+    //! Given a C++ type `X` and a range `[first, last)` of bytes starting
+    //! with the bytes written by `serialize(x, out)` for an object `x` of
+    //! type `X`, `deserialize<X>(first, last)` returns an object equal to
+    //! `x`. The object is value-initialized and its members or elements are
+    //! then assigned, so `X` must be default-constructible. `serialized_size`
+    //! of the returned object is the number of bytes that were read; the
+    //! bytes following them are ignored.
+    //!
+    //! No byte outside of `[first, last)` is ever read. If the range ends
+    //! before the representation of `x` does, e.g. because the input is
+    //! truncated or because the size of a `std::vector` is corrupted,
+    //! `std::out_of_range` is thrown. The size of a `std::vector` is checked
+    //! against the number of remaining bytes before memory is allocated for
+    //! its elements, so the memory allocated is bounded by the size of the
+    //! input. The only exception is a `std::vector` whose elements have an
+    //! empty representation, e.g. `Constant`s or `Record`s whose members are
+    //! all empty: its size can't be checked against the input, so the vector
+    //! is resized to that size at once. A size larger than `max_size()`
+    //! throws `std::length_error`, and a size for which memory can't be
+    //! allocated throws `std::bad_alloc`. Otherwise, the bytes are not
+    //! validated, so they must have been written by
+    //! `serialize` for the same type on a machine with the same byte order
+    //! and the same sizes for the trivially copyable types.
+    //!
+    //! When specialized, `deserialize_impl<T>::apply(first, last, x)` must
+    //! read the representation of `x` from `[first, last)` with the same
+    //! checks and return a pointer past the last byte it read.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/serialization.cpp serialize
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    template <typename X>
+    constexpr auto deserialize = [](char const* first, char const* last) -> X {
+        return tag-dispatched;
+    };
+#else
+    template <typename T, typename = void>
+    struct deserialize_impl;
+
+    template <typename X>
+    struct _deserialize {
+        X operator()(char const* first, char const* last) const {
+            using T = typename datatype<X>::type;
+            X x{};
+            deserialize_impl<T>::apply(first, last, x);
+            return x;
+        }
+    };
+
+    template <typename X>
+    constexpr _deserialize<X> deserialize{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_SERIALIZATION_HPP
@@ -41,7 +41,9 @@ namespace boost { namespace hana {
     //! --------------------
     //! 1. From any `Foldable`\n
     //! If the foldable structure contains duplicates, the last one will
-    //! be the one appearing in the resulting set.
+    //! be the one appearing in the resulting set. When all the elements are
+    //! `Type`s or `String`s, the duplicates are found with a single pass
+    //! over the structure instead of inserting the elements one by one.
     struct Set { };
 
     //! Creates a `Set` containing the given elements.
@@ -100,6 +102,78 @@ namespace boost { namespace hana {
         return tag-dispatched;
     };
 #endif
+
+    //! Returns the union of two sets.
+    //! @relates Set
+    //!
+    //! `union_(xs, ys)` contains the elements of `xs` followed by the
+    //! elements of `ys` which are not in `xs`. The elements of both sets
+    //! must be comparable with each other at compile-time.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/set.cpp union_
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto union_ = [](auto&& xs, auto&& ys) {
+        return unspecified-type;
+    };
+#else
+    struct _union {
+        template <typename S1, typename S2>
+        constexpr auto operator()(S1&& s1, S2&& s2) const;
+    };
+
+    constexpr _union union_{};
+#endif
+
+    //! Returns the intersection of two sets.
+    //! @relates Set
+    //!
+    //! `intersection(xs, ys)` contains the elements of `xs` which are also
+    //! in `ys`. The elements of both sets must be comparable with each other
+    //! at compile-time.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/set.cpp intersection
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto intersection = [](auto&& xs, auto&& ys) {
+        return unspecified-type;
+    };
+#else
+    struct _intersection {
+        template <typename S1, typename S2>
+        constexpr auto operator()(S1&& s1, S2&& s2) const;
+    };
+
+    constexpr _intersection intersection{};
+#endif
+
+    //! Returns the elements of a set which are not in another set.
+    //! @relates Set
+    //!
+    //! `difference(xs, ys)` contains the elements of `xs` which are not in
+    //! `ys`. The elements of both sets must be comparable with each other
+    //! at compile-time.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/set.cpp difference
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto difference = [](auto&& xs, auto&& ys) {
+        return unspecified-type;
+    };
+#else
+    struct _difference {
+        template <typename S1, typename S2>
+        constexpr auto operator()(S1&& s1, S2&& s2) const;
+    };
+
+    constexpr _difference difference{};
+#endif
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_SET_HPP
@@ -0,0 +1,66 @@
+/*!
+@file
+Forward declares `boost::hana::soa_vector`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_SOA_VECTOR_HPP
+#define BOOST_HANA_FWD_SOA_VECTOR_HPP
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Runtime sequence of `Record`s storing each member in its own
+    //! contiguous buffer.
+    //!
+    //! A `std::vector<R>` stores its elements one after the other, so a
+    //! loop reading a single member of each element also loads all the
+    //! other members of that element into the cache. A `soa_vector<R>`
+    //! instead holds one `std::vector` per member of `R`, in the order of
+    //! `members<R>()`. A loop reading a few members of each element then
+    //! only touches the buffers of those members.
+    //!
+    //! The names and the accessors of the members are those of
+    //! `members<R>()`, so `R` can be any `Record` whose accessors return
+    //! references to its members when called on an lvalue, which is the
+    //! case for records defined with `BOOST_HANA_DEFINE_RECORD` and
+    //! `BOOST_HANA_DEFINE_RECORD_INTRUSIVE`. The type of each buffer is
+    //! the decayed type returned by the corresponding accessor.
+    //!
+    //! Since a `soa_vector<R>` does not store any object of type `R`,
+    //! `operator[]` with an index returns a proxy instead of a reference.
+    //! The proxy gives access to the members of the element by name, can
+    //! be assigned an object of type `R` and can be converted to an object
+    //! of type `R`, which requires `R` to be default-constructible.
+    //! `operator[]` with the name of a member returns the buffer holding
+    //! that member, which is a `std::vector`. Only names which are `String`s
+    //! or `Type`s can be used this way, since the buffer is found by
+    //! comparing the C++ type of the name with those of the member names.
+    //! @snippet example/soa_vector.cpp main
+    //!
+    //! `push_back` provides the strong exception guarantee: if allocating
+    //! memory or copying a member throws, the `soa_vector` is unchanged.
+    //! When the element is an rvalue, the members moved before the
+    //! exception was thrown are left in a valid but unspecified state.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Record`\n
+    //! The members of a `soa_vector<R>` are its buffers, and they have
+    //! the same names as the members of `R`. In particular, folding a
+    //! `soa_vector<R>` (e.g. with `for_each`) visits its buffers in the
+    //! order of `members<R>()`, and two `soa_vector`s are equal when all
+    //! their buffers are equal.
+    //! @snippet example/soa_vector.cpp Record
+    //!
+    //! @note
+    //! This header includes `<vector>`. For this reason, it is not included
+    //! by default by the master header of the library.
+    template <typename R>
+    struct soa_vector;
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_SOA_VECTOR_HPP
@@ -34,11 +34,33 @@ namespace boost { namespace hana {
     //! ----------------
     //! `Sequence`, and all its superclasses
     //!
+    //! Additionally, tuples of the same length can be added, subtracted and
+    //! multiplied element-wise with `plus`, `minus` and `mult`, and `negate`
+    //! negates every element. When the elements are `Constant`s, the result
+    //! is a tuple of `Constant`s computed at compile-time. Since the length
+    //! of a tuple is not part of its data type, there is no `zero<Tuple>()`
+    //! or `one<Tuple>()`, so these methods do not make `Tuple` a model of
+    //! `Monoid`, `Group` or `Ring` in the strict sense.
+    //! @snippet example/tuple.cpp arithmetic
+    //!
     //!
     //! Provided operators
     //! ------------------
     //! For convenience, operators for methods of the following concepts can
-    //! be used with `Tuple`: `Comparable`, `Orderable`, `Monad`, `Iterable`.
+    //! be used with `Tuple`: `Comparable`, `Orderable`, `Monoid`, `Group`,
+    //! `Ring`, `Monad`, `Iterable`.
+    //!
+    //!
+    //! Headers
+    //! -------
+    //! `boost/hana/tuple.hpp` defines `Tuple` with all its models. To only
+    //! use the container, `boost/hana/tuple/core.hpp` defines `_tuple`,
+    //! `make`, `at`, `unpack` and `xs[n]` without including the rest of
+    //! the concepts. The other models are then defined by the headers of
+    //! `boost/hana/tuple/` named after their concept, like
+    //! `boost/hana/tuple/orderable.hpp`; a model must be included before
+    //! its methods are used with a `Tuple`. The elements of `tuple_t` are
+    //! `Type`s, so it also requires `boost/hana/type.hpp`.
     struct Tuple { };
 
     template <typename ...Xs>
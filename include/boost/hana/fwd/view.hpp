@@ -0,0 +1,211 @@
+/*!
+@file
+Forward declares `boost::hana::View`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_VIEW_HPP
+#define BOOST_HANA_FWD_VIEW_HPP
+
+#include <boost/hana/config.hpp>
+
+
+namespace boost { namespace hana {
+    //! @ingroup group-datatypes
+    //! Non-owning and lazy adaptor over the elements of a `Tuple`.
+    //!
+    //! A `View` refers to the elements of a `Tuple` without holding them,
+    //! and it is created by `viewed` or by one of the view adaptors
+    //! `transformed`, `filtered`, `sliced`, `reversed` and `joined`.
+    //! These adaptors can
+    //! be applied to a `Tuple` or to another `View`, so whole pipelines like
+    //! @code
+    //!     transformed(filtered(transformed(xs, f), pred), g)
+    //! @endcode
+    //! can be expressed without building an intermediate `Tuple` at each
+    //! step. Instead, the elements are computed on the fly when they are
+    //! accessed, and a new `Tuple` is only created when the view is
+    //! explicitly converted with `to<Tuple>`.
+    //!
+    //! Since a `View` does not own its elements, the `Tuple`s it refers to
+    //! must outlive it. For this reason, views can't be created from
+    //! temporary tuples. Also, the functions passed to `transformed` are
+    //! called every time an element is accessed, so they should be cheap
+    //! and free of side effects.
+    //!
+    //!
+    //! Modeled concepts
+    //! ----------------
+    //! 1. `Foldable`\n
+    //! Folding a `View` is equivalent to folding the sequence of elements
+    //! it represents.
+    //! @snippet example/view.cpp foldable
+    //!
+    //! 2. `Iterable` (operators provided)\n
+    //! Iterating over a `View` is equivalent to iterating over the sequence
+    //! of elements it represents. In particular, `tail`, `drop` and `uncons`
+    //! return views over the same elements. When the view refers to
+    //! consecutive elements of a `Tuple`, like `viewed(xs)` or
+    //! `sliced(xs, from, to)`, these views are only a pointer to the `Tuple`
+    //! and a compile-time offset, so recursive algorithms can iterate over
+    //! them without copying any element.
+    //! @snippet example/view.cpp iterable
+    //!
+    //! 3. `Searchable`\n
+    //! Searching a `View` is equivalent to searching the sequence of
+    //! elements it represents.
+    //! @snippet example/view.cpp searchable
+    //!
+    //!
+    //! Conversion to `Tuple`
+    //! ---------------------
+    //! A `View` can be materialized into a `Tuple` holding copies of the
+    //! elements it represents with `to<Tuple>`.
+    //! @snippet example/view.cpp to<Tuple>
+    struct View { };
+
+    //! Returns a view of all the elements of a sequence.
+    //! @relates View
+    //!
+    //! Given a `Tuple` `xs`, `viewed(xs)` is a view of the elements of `xs`
+    //! which can be passed to algorithms instead of `xs` to avoid copying
+    //! the elements of `xs` when these algorithms call `tail` or `drop`.
+    //! Given a `View`, `viewed` returns it unchanged.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp viewed
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto viewed = [](auto&& xs) {
+        return unspecified-type;
+    };
+#else
+    struct _viewed {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const;
+    };
+
+    constexpr _viewed viewed{};
+#endif
+
+    //! Returns a view of the elements of a sequence with a function
+    //! applied to them.
+    //! @relates View
+    //!
+    //! Given a `Tuple` or a `View` `xs` and a function `f`,
+    //! `transformed(xs, f)` is a view whose `i`th element is `f(xi)`.
+    //! `f` is called every time an element of the view is accessed.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp transformed
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto transformed = [](auto&& xs, auto&& f) {
+        return unspecified-type;
+    };
+#else
+    struct _transformed {
+        template <typename Xs, typename F>
+        constexpr auto operator()(Xs&& xs, F&& f) const;
+    };
+
+    constexpr _transformed transformed{};
+#endif
+
+    //! Returns a view of the elements of a sequence satisfying a predicate.
+    //! @relates View
+    //!
+    //! Given a `Tuple` or a `View` `xs` and a predicate `pred` returning a
+    //! `Constant` `Logical` for every element of `xs`, `filtered(xs, pred)`
+    //! is a view of the elements of `xs` for which `pred` returns a
+    //! true-valued `Logical`. Since the result of `pred` only depends on
+    //! the type of the elements, `pred` is never actually called.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp filtered
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto filtered = [](auto&& xs, auto&& pred) {
+        return unspecified-type;
+    };
+#else
+    struct _filtered {
+        template <typename Xs, typename Pred>
+        constexpr auto operator()(Xs&& xs, Pred&& pred) const;
+    };
+
+    constexpr _filtered filtered{};
+#endif
+
+    //! Returns a view of the elements of a sequence in the half-open
+    //! interval of indices `[from, to)`.
+    //! @relates View
+    //!
+    //! `from` and `to` must be non-negative `Constant`s such that
+    //! `from <= to <= length(xs)`.
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp sliced
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto sliced = [](auto&& xs, auto&& from, auto&& to) {
+        return unspecified-type;
+    };
+#else
+    struct _sliced {
+        template <typename Xs, typename From, typename To>
+        constexpr auto operator()(Xs&& xs, From const& from, To const& to) const;
+    };
+
+    constexpr _sliced sliced{};
+#endif
+
+    //! Returns a view of the elements of a sequence in reverse order.
+    //! @relates View
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp reversed
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto reversed = [](auto&& xs) {
+        return unspecified-type;
+    };
+#else
+    struct _reversed {
+        template <typename Xs>
+        constexpr auto operator()(Xs&& xs) const;
+    };
+
+    constexpr _reversed reversed{};
+#endif
+
+    //! Returns a view of the elements of two sequences, one after the other.
+    //! @relates View
+    //!
+    //!
+    //! Example
+    //! -------
+    //! @snippet example/view.cpp joined
+#ifdef BOOST_HANA_DOXYGEN_INVOKED
+    constexpr auto joined = [](auto&& xs, auto&& ys) {
+        return unspecified-type;
+    };
+#else
+    struct _joined {
+        template <typename Xs, typename Ys>
+        constexpr auto operator()(Xs&& xs, Ys&& ys) const;
+    };
+
+    constexpr _joined joined{};
+#endif
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_VIEW_HPP
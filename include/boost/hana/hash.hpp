@@ -0,0 +1,176 @@
+/*!
+@file
+Defines `boost::hana::hash`.
+
+@note
+This header includes `<functional>`. For this reason, it is not included
+by default by the master header of the library.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_HASH_HPP
+#define BOOST_HANA_HASH_HPP
+
+#include <boost/hana/fwd/hash.hpp>
+
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/has_unique_bytes.hpp>
+#include <boost/hana/detail/hash_bytes.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/product.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <functional>
+
+
+namespace boost { namespace hana {
+    namespace hash_detail {
+        template <typename X>
+        detail::std::size_t hash_bytes_of(X const& x) {
+            return static_cast<detail::std::size_t>(detail::hash_bytes(
+                &reinterpret_cast<char const&>(x), sizeof(X)
+            ));
+        }
+
+        // Combines the hash values of the objects it is called with, in
+        // order.
+        struct combine {
+            template <typename ...X>
+            detail::std::size_t operator()(X const& ...x) const {
+                unsigned long long h = 0x9e3779b97f4a7c15ull;
+                using swallow = int[];
+                (void)swallow{1, (h = detail::hash_mix(
+                    h * 0xbf58476d1ce4e5b9ull +
+                    static_cast<detail::std::size_t>(hana::hash(x))
+                ), 1)...};
+                return static_cast<detail::std::size_t>(h);
+            }
+        };
+
+        template <typename X, typename T = typename datatype<X>::type,
+                  bool = _models<Constant, T>{}>
+        struct is_integral_constant : detail::std::false_type { };
+
+        template <typename X, typename T>
+        struct is_integral_constant<X, T, true>
+            : detail::std::is_integral<
+                typename detail::std::decay<decltype(hana::value<X>())>::type
+            >
+        { };
+
+        // How an object is hashed:
+        // 0. The hash value is computed at compile-time from the value
+        //    of a `Constant`.
+        // 1. The bytes of the object are hashed.
+        // 2. The members of the `Record` are hashed.
+        // 3. The object is hashed with `std::hash`.
+        template <typename X>
+        using kind = detail::std::integral_constant<int,
+            is_integral_constant<X>{} ? 0 :
+            detail::has_unique_bytes<X>{} ? 1 :
+            _models<Record, X>{} ? 2 :
+            3
+        >;
+
+        template <int k>
+        using kind_c = detail::std::integral_constant<int, k>;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // hash
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename>
+    struct hash_impl : hash_impl<T, when<true>> { };
+
+    template <typename T, bool condition>
+    struct hash_impl<T, when<condition>> : default_ {
+        template <typename X>
+        static constexpr auto helper(X const&, hash_detail::kind_c<0>) {
+            constexpr auto v = hana::value<X>();
+            return size_t<static_cast<detail::std::size_t>(
+                detail::hash_mix(0x9e3779b97f4a7c15ull ^
+                                 static_cast<unsigned long long>(v))
+            )>;
+        }
+
+        template <typename X>
+        static detail::std::size_t helper(X const& x, hash_detail::kind_c<1>)
+        { return hash_detail::hash_bytes_of(x); }
+
+        template <typename X>
+        static detail::std::size_t helper(X const& x, hash_detail::kind_c<2>)
+        { return hana::unpack(x, hash_detail::combine{}); }
+
+        template <typename X>
+        static detail::std::size_t helper(X const& x, hash_detail::kind_c<3>)
+        { return ::std::hash<X>{}(x); }
+
+        template <typename X>
+        static constexpr decltype(auto) apply(X const& x)
+        { return helper(x, hash_detail::kind<X>{}); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // String
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct hash_impl<String> {
+        template <char ...s>
+        static constexpr auto apply(_string<s...> const&) {
+            constexpr char const c_str[] = {s..., '\0'};
+            return size_t<static_cast<detail::std::size_t>(
+                detail::hash_bytes(c_str, sizeof...(s))
+            )>;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Tuple and Pair
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct hash_impl<Tuple> {
+        template <typename Xs>
+        static detail::std::size_t helper(Xs const& xs, detail::std::true_type)
+        { return hash_detail::hash_bytes_of(xs); }
+
+        template <typename Xs>
+        static detail::std::size_t helper(Xs const& xs, detail::std::false_type)
+        { return hana::unpack(xs, hash_detail::combine{}); }
+
+        template <typename Xs>
+        static detail::std::size_t apply(Xs const& xs)
+        { return helper(xs, detail::has_unique_bytes<Xs>{}); }
+    };
+
+    template <>
+    struct hash_impl<Pair> {
+        template <typename P>
+        static detail::std::size_t helper(P const& p, detail::std::true_type)
+        { return hash_detail::hash_bytes_of(p); }
+
+        template <typename P>
+        static detail::std::size_t helper(P const& p, detail::std::false_type)
+        { return hash_detail::combine{}(hana::first(p), hana::second(p)); }
+
+        template <typename P>
+        static detail::std::size_t apply(P const& p)
+        { return helper(p, detail::has_unique_bytes<P>{}); }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_HASH_HPP
@@ -0,0 +1,765 @@
+/*!
+@file
+Defines `boost::hana::HomogeneousTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_HOMOGENEOUS_TUPLE_HPP
+#define BOOST_HANA_HOMOGENEOUS_TUPLE_HPP
+
+#include <boost/hana/fwd/homogeneous_tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/convert.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/dependent_on.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/std/void_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/group.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/monoid.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/ring.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // _homogeneous_tuple
+    //////////////////////////////////////////////////////////////////////////
+    namespace homogeneous_tuple_detail {
+        // Storage of an empty homogeneous tuple. Contrary to an empty
+        // `detail::array`, it does not require `T` to be default
+        // constructible. Loops never access its elements.
+        template <typename T>
+        struct empty_storage {
+            constexpr T* begin() const noexcept { return nullptr; }
+            constexpr T* end() const noexcept { return nullptr; }
+            T& operator[](detail::std::size_t) const { return *begin(); }
+        };
+
+        template <typename T, detail::std::size_t n>
+        using storage = typename detail::std::conditional<n == 0,
+            empty_storage<T>, detail::array<T, n>
+        >::type;
+    }
+
+    // Like for `_tuple`, we do not inherit from `operators::adl`, since
+    // `operators::Iterable_ops` already makes the operators visible to ADL.
+    template <typename T, detail::std::size_t n>
+    struct _homogeneous_tuple
+        : operators::Iterable_ops<_homogeneous_tuple<T, n>>
+    {
+        homogeneous_tuple_detail::storage<T, n> storage;
+
+        _homogeneous_tuple() = default;
+
+        explicit constexpr
+        _homogeneous_tuple(homogeneous_tuple_detail::storage<T, n> const& xs)
+            : storage(xs)
+        { }
+
+        explicit constexpr
+        _homogeneous_tuple(homogeneous_tuple_detail::storage<T, n>&& xs)
+            : storage(detail::std::move(xs))
+        { }
+
+        using hana = _homogeneous_tuple;
+        using datatype = HomogeneousTuple;
+
+        using value_type = T;
+        static constexpr detail::std::size_t size = n;
+    };
+
+    template <>
+    struct operators::of<HomogeneousTuple>
+        : operators::of<Comparable, Orderable, Monoid, Group, Ring, Iterable>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace homogeneous_tuple_detail {
+        template <typename Xs>
+        using size = _integral_constant<detail::std::size_t,
+            detail::std::remove_reference<Xs>::type::size
+        >;
+
+        // Returns the `k`th element of a homogeneous tuple, as an rvalue
+        // when the tuple is an rvalue. This is the runtime analogue of
+        // `detail::get`.
+        template <typename T, detail::std::size_t n>
+        constexpr T& get(_homogeneous_tuple<T, n>& xs, detail::std::size_t k)
+        { return xs.storage[k]; }
+
+        template <typename T, detail::std::size_t n>
+        constexpr T const&
+        get(_homogeneous_tuple<T, n> const& xs, detail::std::size_t k)
+        { return xs.storage[k]; }
+
+        template <typename T, detail::std::size_t n>
+        constexpr T&& get(_homogeneous_tuple<T, n>&& xs, detail::std::size_t k)
+        { return static_cast<T&&>(xs.storage[k]); }
+
+        template <typename Xs>
+        using element_t = decltype(homogeneous_tuple_detail::get(
+            detail::std::declval<Xs>(), 0
+        ));
+
+        template <typename T, typename X, typename ...Xs>
+        constexpr _homogeneous_tuple<T, sizeof...(Xs) + 1>
+        make_from(X&& x, Xs&& ...xs) {
+            return _homogeneous_tuple<T, sizeof...(Xs) + 1>{
+                detail::array<T, sizeof...(Xs) + 1>{{
+                    detail::std::forward<X>(x), detail::std::forward<Xs>(xs)...
+                }}
+            };
+        }
+
+        template <typename T>
+        constexpr _homogeneous_tuple<T, 0> make_from()
+        { return _homogeneous_tuple<T, 0>{}; }
+
+        template <typename R>
+        using is_constant = _integral_constant<bool,
+            _models<Constant, typename datatype<R>::type>{}
+        >;
+
+        // Whether `f(state, x)` (or `f(x, state)` for right folds) returns a
+        // state of the same type as `state`, which can be assigned to the
+        // current state. When this is the case, the remaining elements can
+        // be folded with a runtime loop without instantiating anything else.
+        template <typename F, typename State, typename X, typename = void>
+        struct preserves_left_state : detail::std::false_type { };
+
+        template <typename F, typename State, typename X>
+        struct preserves_left_state<F, State, X, detail::std::void_t<
+            decltype(detail::std::declval<State&>() =
+                detail::std::declval<F&>()(detail::std::declval<State>(),
+                                           detail::std::declval<X>()))
+        >>
+            : detail::std::is_same<typename detail::std::decay<
+                decltype(detail::std::declval<F&>()(detail::std::declval<State>(),
+                                                    detail::std::declval<X>()))
+            >::type, State>
+        { };
+
+        template <typename F, typename State, typename X, typename = void>
+        struct preserves_right_state : detail::std::false_type { };
+
+        template <typename F, typename State, typename X>
+        struct preserves_right_state<F, State, X, detail::std::void_t<
+            decltype(detail::std::declval<State&>() =
+                detail::std::declval<F&>()(detail::std::declval<X>(),
+                                           detail::std::declval<State>()))
+        >>
+            : detail::std::is_same<typename detail::std::decay<
+                decltype(detail::std::declval<F&>()(detail::std::declval<X>(),
+                                                    detail::std::declval<State>()))
+            >::type, State>
+        { };
+
+        template <typename F, typename State, typename Xs>
+        using loop_left = _integral_constant<bool, preserves_left_state<
+            F, typename detail::std::decay<State>::type, element_t<Xs>
+        >{}>;
+
+        template <typename F, typename State, typename Xs>
+        using loop_right = _integral_constant<bool, preserves_right_state<
+            F, typename detail::std::decay<State>::type, element_t<Xs>
+        >{}>;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<HomogeneousTuple> {
+        template <typename X, typename ...Xs>
+        static constexpr auto apply(X&& x, Xs&& ...xs) {
+            using T = typename detail::std::decay<X>::type;
+            constexpr bool same[] = {true, detail::std::is_same<
+                T, typename detail::std::decay<Xs>::type
+            >{}...};
+            static_assert(tuple_detail::all(same),
+            "hana::make<HomogeneousTuple>(xs...) requires all the xs to have "
+            "the same type");
+
+            return homogeneous_tuple_detail::make_from<T>(
+                detail::std::forward<X>(x), detail::std::forward<Xs>(xs)...
+            );
+        }
+
+        template <bool dependent = false>
+        static constexpr void apply() {
+            static_assert(dependent,
+            "hana::make<HomogeneousTuple>() can't deduce the type of the "
+            "elements; use hana::empty_homogeneous_tuple<T> instead");
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<HomogeneousTuple, HomogeneousTuple> {
+        template <typename Xs, typename Ys>
+        static constexpr auto helper(decltype(false_), Xs const&, Ys const&)
+        { return false_; }
+
+        template <typename Xs, typename Ys>
+        static constexpr bool helper(decltype(true_), Xs const& xs, Ys const& ys) {
+            for (detail::std::size_t k = 0; k < Xs::size; ++k)
+                if (!hana::if_(hana::equal(xs.storage[k], ys.storage[k]), true, false))
+                    return false;
+            return true;
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs const& xs, Ys const& ys)
+        { return helper(bool_<Xs::size == Ys::size>, xs, ys); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct less_impl<HomogeneousTuple, HomogeneousTuple> {
+        template <typename Xs, typename Ys>
+        static constexpr bool apply(Xs const& xs, Ys const& ys) {
+            constexpr detail::std::size_t size =
+                Xs::size < Ys::size ? Xs::size : Ys::size;
+            for (detail::std::size_t k = 0; k < size; ++k) {
+                if (hana::if_(hana::less(xs.storage[k], ys.storage[k]), true, false))
+                    return true;
+                if (hana::if_(hana::less(ys.storage[k], xs.storage[k]), true, false))
+                    return false;
+            }
+            return Xs::size < Ys::size;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<HomogeneousTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr auto
+        transform_helper(Xs&& xs, F& f, detail::std::index_sequence<i...>) {
+            using U = typename detail::std::decay<decltype(
+                f(detail::std::declval<homogeneous_tuple_detail::element_t<Xs>>())
+            )>::type;
+            return homogeneous_tuple_detail::make_from<U>(
+                f(homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), i))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            return transform_helper(detail::std::forward<Xs>(xs), f,
+                                    detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monoid, Group and Ring
+    //
+    // Homogeneous tuples of the same length are added, subtracted and
+    // multiplied element-wise. The elements are combined by straight-line
+    // code on contiguous storage, which the optimizer turns into vector
+    // instructions for arithmetic element types.
+    //////////////////////////////////////////////////////////////////////////
+    namespace homogeneous_tuple_detail {
+        template <typename F, typename Xs, typename Ys, detail::std::size_t ...i>
+        constexpr auto zip_with_helper(F const& f, Xs&& xs, Ys&& ys,
+                                       detail::std::index_sequence<i...>)
+        {
+            using U = typename detail::std::decay<decltype(
+                f(detail::std::declval<element_t<Xs>>(),
+                  detail::std::declval<element_t<Ys>>())
+            )>::type;
+            return homogeneous_tuple_detail::make_from<U>(
+                f(homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), i),
+                  homogeneous_tuple_detail::get(detail::std::forward<Ys>(ys), i))...
+            );
+        }
+
+        template <typename F, typename Xs, typename Ys>
+        constexpr auto zip_with(F const& f, Xs&& xs, Ys&& ys) {
+            constexpr detail::std::size_t n = size<Xs>{};
+            static_assert(n == size<Ys>{},
+            "boost::hana::plus, minus and mult require homogeneous tuples of the same length");
+            return zip_with_helper(f, detail::std::forward<Xs>(xs),
+                                      detail::std::forward<Ys>(ys),
+                                      detail::std::make_index_sequence<n>{});
+        }
+    }
+
+    template <>
+    struct plus_impl<HomogeneousTuple, HomogeneousTuple> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys&& ys) {
+            return homogeneous_tuple_detail::zip_with(hana::plus,
+                detail::std::forward<Xs>(xs), detail::std::forward<Ys>(ys));
+        }
+    };
+
+    template <>
+    struct minus_impl<HomogeneousTuple, HomogeneousTuple> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys&& ys) {
+            return homogeneous_tuple_detail::zip_with(hana::minus,
+                detail::std::forward<Xs>(xs), detail::std::forward<Ys>(ys));
+        }
+    };
+
+    template <>
+    struct negate_impl<HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs)
+        { return hana::transform(detail::std::forward<Xs>(xs), negate); }
+    };
+
+    template <>
+    struct mult_impl<HomogeneousTuple, HomogeneousTuple> {
+        template <typename Xs, typename Ys>
+        static constexpr auto apply(Xs&& xs, Ys&& ys) {
+            return homogeneous_tuple_detail::zip_with(hana::mult,
+                detail::std::forward<Xs>(xs), detail::std::forward<Ys>(ys));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //
+    // The left and right folds call `f` on the first elements until it
+    // returns a state with the same type as its previous state, and then
+    // fold the remaining elements with a runtime loop.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct foldl_impl<HomogeneousTuple> {
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr auto
+        step(decltype(true_), Xs&& xs, State&& s, F& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            // `f` may return a reference to the state it was given, so the
+            // new state is materialized before it is assigned.
+            using S = typename detail::std::decay<State>::type;
+            S state = detail::std::forward<State>(s);
+            for (detail::std::size_t k = i; k < size; ++k)
+                state = S(f(detail::std::move(state),
+                    homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), k)));
+            return state;
+        }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        step(decltype(false_), Xs&& xs, State&& s, F& f) {
+            return fold_from<i + 1>(detail::std::forward<Xs>(xs),
+                f(detail::std::forward<State>(s),
+                  homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), i)),
+                f);
+        }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr auto
+        fold_helper(decltype(true_), Xs&&, State&& s, F&)
+        { return detail::std::forward<State>(s); }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        fold_helper(decltype(false_), Xs&& xs, State&& s, F& f) {
+            using Loop = homogeneous_tuple_detail::loop_left<F, State, Xs>;
+            return step<i>(Loop{}, detail::std::forward<Xs>(xs),
+                                   detail::std::forward<State>(s), f);
+        }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr decltype(auto) fold_from(Xs&& xs, State&& s, F& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            return fold_helper<i>(bool_<i == size>, detail::std::forward<Xs>(xs),
+                                  detail::std::forward<State>(s), f);
+        }
+
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, State&& s, F&& f) {
+            return fold_from<0>(detail::std::forward<Xs>(xs),
+                                detail::std::forward<State>(s), f);
+        }
+    };
+
+    template <>
+    struct foldl1_impl<HomogeneousTuple> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return foldl_impl<HomogeneousTuple>::fold_from<1>(
+                detail::std::forward<Xs>(xs),
+                homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), 0),
+                f
+            );
+        }
+    };
+
+    template <>
+    struct foldr_impl<HomogeneousTuple> {
+        // Here, `i` is the number of elements which remain to be folded,
+        // so the next element to be folded is at index `i - 1`.
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr auto
+        step(decltype(true_), Xs&& xs, State&& s, F& f) {
+            using S = typename detail::std::decay<State>::type;
+            S state = detail::std::forward<State>(s);
+            for (detail::std::size_t k = i; k != 0; --k)
+                state = S(f(homogeneous_tuple_detail::get(
+                                detail::std::forward<Xs>(xs), k - 1),
+                            detail::std::move(state)));
+            return state;
+        }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        step(decltype(false_), Xs&& xs, State&& s, F& f) {
+            return fold_from<i - 1>(detail::std::forward<Xs>(xs),
+                f(homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), i - 1),
+                  detail::std::forward<State>(s)),
+                f);
+        }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr auto
+        fold_helper(decltype(true_), Xs&&, State&& s, F&)
+        { return detail::std::forward<State>(s); }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        fold_helper(decltype(false_), Xs&& xs, State&& s, F& f) {
+            using Loop = homogeneous_tuple_detail::loop_right<F, State, Xs>;
+            return step<i>(Loop{}, detail::std::forward<Xs>(xs),
+                                   detail::std::forward<State>(s), f);
+        }
+
+        template <detail::std::size_t i, typename Xs, typename State, typename F>
+        static constexpr decltype(auto) fold_from(Xs&& xs, State&& s, F& f) {
+            return fold_helper<i>(bool_<i == 0>, detail::std::forward<Xs>(xs),
+                                  detail::std::forward<State>(s), f);
+        }
+
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, State&& s, F&& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            return fold_from<size>(detail::std::forward<Xs>(xs),
+                                   detail::std::forward<State>(s), f);
+        }
+    };
+
+    template <>
+    struct tree_fold_impl<HomogeneousTuple> {
+        // When `f(x, y)` returns an element of the same type, the elements
+        // are reduced in a copy of the storage. Each pass combines pairs of
+        // adjacent partial results which do not depend on each other, which
+        // produces the same tree as the default `tree_fold`.
+        template <typename Xs, typename F>
+        static constexpr auto helper(decltype(true_), Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            using T = typename detail::std::remove_reference<Xs>::type::value_type;
+            detail::array<T, size> partials = detail::std::forward<Xs>(xs).storage;
+            for (detail::std::size_t width = 1; width < size; width *= 2)
+                for (detail::std::size_t k = 0; k + width < size; k += 2 * width)
+                    partials[k] = T(f(detail::std::move(partials[k]),
+                                     detail::std::move(partials[k + width])));
+            return detail::std::move(partials[0]);
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) helper(decltype(false_), Xs&& xs, F&& f) {
+            using Tpl = detail::dependent_on_t<sizeof(xs) == 1, HomogeneousTuple>;
+            return tree_fold_impl<Tpl, when<true>>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<F>(f)
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using T = typename detail::std::remove_reference<Xs>::type::value_type;
+            constexpr bool loop = homogeneous_tuple_detail::size<Xs>{} != 0 &&
+                homogeneous_tuple_detail::preserves_left_state<
+                    typename detail::std::remove_reference<F>::type, T, T
+                >{};
+            return helper(bool_<loop>, detail::std::forward<Xs>(xs),
+                                       detail::std::forward<F>(f));
+        }
+    };
+
+    template <>
+    struct foldr1_impl<HomogeneousTuple> {
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            return foldr_impl<HomogeneousTuple>::fold_from<size - 1>(
+                detail::std::forward<Xs>(xs),
+                homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), size - 1),
+                f
+            );
+        }
+    };
+
+    template <>
+    struct for_each_impl<HomogeneousTuple> {
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            for (detail::std::size_t k = 0; k < size; ++k)
+                f(homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), k));
+        }
+    };
+
+    template <>
+    struct unpack_impl<HomogeneousTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::std::forward<F>(f)(
+                homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), i)...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            return unpack_helper(detail::std::forward<Xs>(xs),
+                                 detail::std::forward<F>(f),
+                                 detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    template <>
+    struct length_impl<HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<Xs::size>; }
+    };
+
+    template <>
+    struct count_if_impl<HomogeneousTuple> {
+        template <typename R, typename Xs, typename Pred>
+        static constexpr auto helper(decltype(true_), Xs&&, Pred&&) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            constexpr bool satisfied = hana::if_(hana::value<R>(), true, false);
+            return size_t<satisfied ? size : 0>;
+        }
+
+        template <typename R, typename Xs, typename Pred>
+        static constexpr detail::std::size_t
+        helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            detail::std::size_t count = 0;
+            for (detail::std::size_t k = 0; k < size; ++k)
+                count += hana::if_(pred(homogeneous_tuple_detail::get(
+                                    detail::std::forward<Xs>(xs), k)), 1, 0);
+            return count;
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            using R = decltype(pred(detail::std::declval<
+                homogeneous_tuple_detail::element_t<Xs>
+            >()));
+            return helper<R>(homogeneous_tuple_detail::is_constant<R>{},
+                             detail::std::forward<Xs>(xs),
+                             detail::std::forward<Pred>(pred));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct head_impl<HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), 0); }
+    };
+
+    template <>
+    struct at_impl<HomogeneousTuple> {
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr detail::std::size_t index = hana::value<N>();
+            return homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), index);
+        }
+    };
+
+    template <>
+    struct visit_at_impl<HomogeneousTuple> {
+        template <typename Xs, typename F>
+        static bool apply(detail::std::size_t n, Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            if (n >= size)
+                return false;
+            f(homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), n));
+            return true;
+        }
+    };
+
+    template <>
+    struct last_impl<HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            return homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), size - 1);
+        }
+    };
+
+    template <>
+    struct is_empty_impl<HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return bool_<Xs::size == 0>; }
+    };
+
+    template <>
+    struct drop_impl<HomogeneousTuple> {
+        using Size = detail::std::size_t;
+
+        template <Size n, typename Xs, Size ...i>
+        static constexpr auto
+        drop_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            using T = typename detail::std::remove_reference<Xs>::type::value_type;
+            return homogeneous_tuple_detail::make_from<T>(
+                homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), n + i)...
+            );
+        }
+
+        template <typename N, typename Xs>
+        static constexpr auto apply(N const&, Xs&& xs) {
+            constexpr Size n = hana::value<N>();
+            constexpr Size size = homogeneous_tuple_detail::size<Xs>{};
+            constexpr Size drop_size = n > size ? size : n;
+            return drop_helper<drop_size>(detail::std::forward<Xs>(xs),
+                detail::std::make_index_sequence<size - drop_size>{});
+        }
+    };
+
+    template <>
+    struct tail_impl<HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            return drop_impl<HomogeneousTuple>::drop_helper<1>(
+                detail::std::forward<Xs>(xs),
+                detail::std::make_index_sequence<size - 1>{}
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //
+    // Since the predicate is always called with arguments of the same type,
+    // a `Constant` result is the same for every element.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct any_of_impl<HomogeneousTuple> {
+        template <typename R, typename Xs, typename Pred>
+        static constexpr auto helper(decltype(true_), Xs&&, Pred&&) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            constexpr bool satisfied = hana::if_(hana::value<R>(), true, false);
+            return bool_<size != 0 && satisfied>;
+        }
+
+        template <typename R, typename Xs, typename Pred>
+        static constexpr bool helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            for (detail::std::size_t k = 0; k < size; ++k)
+                if (hana::if_(pred(homogeneous_tuple_detail::get(
+                                detail::std::forward<Xs>(xs), k)), true, false))
+                    return true;
+            return false;
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            using R = decltype(pred(detail::std::declval<
+                homogeneous_tuple_detail::element_t<Xs>
+            >()));
+            return helper<R>(homogeneous_tuple_detail::is_constant<R>{},
+                             detail::std::forward<Xs>(xs),
+                             detail::std::forward<Pred>(pred));
+        }
+    };
+
+    template <>
+    struct find_if_impl<HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr auto found(decltype(true_), Xs&& xs) {
+            return hana::just(
+                homogeneous_tuple_detail::get(detail::std::forward<Xs>(xs), 0));
+        }
+
+        template <typename Xs>
+        static constexpr auto found(decltype(false_), Xs&&)
+        { return nothing; }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&&) {
+            using R = decltype(detail::std::declval<Pred&>()(detail::std::declval<
+                homogeneous_tuple_detail::element_t<Xs>
+            >()));
+            static_assert(homogeneous_tuple_detail::is_constant<R>{},
+            "hana::find_if(xs, pred) requires pred to return a Constant when "
+            "xs is a HomogeneousTuple");
+
+            constexpr detail::std::size_t size = homogeneous_tuple_detail::size<Xs>{};
+            constexpr bool satisfied = hana::if_(hana::value<R>(), true, false);
+            return found(bool_<size != 0 && satisfied>,
+                         detail::std::forward<Xs>(xs));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversions
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct to_impl<Tuple, HomogeneousTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return hana::unpack(detail::std::forward<Xs>(xs), make<Tuple>); }
+    };
+
+    template <>
+    struct to_impl<HomogeneousTuple, Tuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return hana::unpack(detail::std::forward<Xs>(xs),
+                                make<HomogeneousTuple>);
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_HOMOGENEOUS_TUPLE_HPP
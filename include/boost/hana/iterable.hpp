@@ -19,7 +19,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/iterable_ops.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/move.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/enumerable.hpp>
 #include <boost/hana/foldable.hpp>
@@ -37,38 +40,6 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 namespace boost { namespace hana {
-    //////////////////////////////////////////////////////////////////////////
-    // Operators
-    //////////////////////////////////////////////////////////////////////////
-    namespace operators {
-        template <typename Derived>
-        struct Iterable_ops {
-            template <typename I>
-            constexpr decltype(auto) operator[](I&& i) const& {
-                return hana::at(
-                    detail::std::forward<I>(i),
-                    static_cast<Derived const&>(*this)
-                );
-            }
-
-            template <typename I>
-            constexpr decltype(auto) operator[](I&& i) & {
-                return hana::at(
-                    detail::std::forward<I>(i),
-                    static_cast<Derived&>(*this)
-                );
-            }
-
-            template <typename I>
-            constexpr decltype(auto) operator[](I&& i) && {
-                return hana::at(
-                    detail::std::forward<I>(i),
-                    static_cast<Derived&&>(*this)
-                );
-            }
-        };
-    }
-
     //////////////////////////////////////////////////////////////////////////
     // head
     //////////////////////////////////////////////////////////////////////////
@@ -91,6 +62,24 @@ namespace boost { namespace hana {
         static void apply(...);
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // uncons
+    //////////////////////////////////////////////////////////////////////////
+    template <typename It, typename>
+    struct uncons_impl : uncons_impl<It, when<true>> { };
+
+    template <typename It, bool condition>
+    struct uncons_impl<It, when<condition>> : default_ {
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            // The head is taken out first, so that `tail` may then reuse the
+            // other elements of `xs` when it is an rvalue.
+            auto x = hana::head(detail::std::forward<Xs>(xs));
+            return hana::pair(detail::std::move(x),
+                              hana::tail(detail::std::forward<Xs>(xs)));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // is_empty
     //////////////////////////////////////////////////////////////////////////
@@ -102,6 +91,17 @@ namespace boost { namespace hana {
         static void apply(...);
     };
 
+    namespace iterable_detail {
+        // Since `is_empty` returns a compile-time `Logical`, the default
+        // methods below dispatch on its value instead of using `eval_if`.
+        // This way, they can pass the remaining elements to the next step
+        // with `uncons` instead of copying them into lazy expressions.
+        template <typename Xs>
+        using is_empty_t = decltype(bool_<hana::if_(hana::value<
+            decltype(hana::is_empty(detail::std::declval<Xs&>()))
+        >(), true, false)>);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // at
     //////////////////////////////////////////////////////////////////////////
@@ -130,6 +130,30 @@ namespace boost { namespace hana {
         { return hana::at(size_t<n>, detail::std::forward<Xs>(xs)); }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // visit_at
+    //////////////////////////////////////////////////////////////////////////
+    template <typename It, typename>
+    struct visit_at_impl : visit_at_impl<It, when<true>> { };
+
+    template <typename It, bool condition>
+    struct visit_at_impl<It, when<condition>> : default_ {
+        template <typename Xs, typename F>
+        static bool apply(detail::std::size_t i, Xs&& xs, F&& f) {
+            return hana::eval_if(hana::is_empty(xs),
+                [](auto) { return false; },
+                [&](auto _) {
+                    if (i == 0) {
+                        f(_(head)(detail::std::forward<Xs>(xs)));
+                        return true;
+                    }
+                    return apply(i - 1,
+                                 _(tail)(detail::std::forward<Xs>(xs)), f);
+                }
+            );
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // last
     //////////////////////////////////////////////////////////////////////////
@@ -138,12 +162,22 @@ namespace boost { namespace hana {
 
     template <typename It, bool condition>
     struct last_impl<It, when<condition>> : default_ {
+        template <typename X, typename Xs>
+        static constexpr auto last_helper(decltype(true_), X&& x, Xs&&)
+        { return detail::std::forward<X>(x); }
+
+        template <typename X, typename Xs>
+        static constexpr decltype(auto)
+        last_helper(decltype(false_), X&&, Xs&& xs)
+        { return hana::last(detail::std::forward<Xs>(xs)); }
+
         template <typename Xs>
-        static constexpr auto apply(Xs xs) {
-            return hana::eval_if(hana::is_empty(hana::tail(xs)),
-                hana::always(hana::head(xs)),
-                hana::lazy(hana::compose(last, tail))(xs)
-            );
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            auto ys = hana::uncons(detail::std::forward<Xs>(xs));
+            using Rest = decltype(hana::second(detail::std::move(ys)));
+            return last_helper(iterable_detail::is_empty_t<Rest>{},
+                               hana::first(detail::std::move(ys)),
+                               hana::second(detail::std::move(ys)));
         }
     };
 
@@ -156,13 +190,21 @@ namespace boost { namespace hana {
     template <typename It, bool condition>
     struct drop_impl<It, when<condition>> : default_ {
         template <typename N, typename Xs>
-        static constexpr auto apply(N n, Xs xs) {
-            using I = typename datatype<N>::type;
-            return hana::eval_if(
-                hana::or_(hana::equal(n, zero<I>()), hana::is_empty(xs)),
-                hana::always(xs),
-                hana::lazy(hana::lockstep(drop)(pred, tail))(n, xs)
-            );
+        static constexpr auto drop_helper(decltype(true_), N const&, Xs&& xs)
+        { return detail::std::forward<Xs>(xs); }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto)
+        drop_helper(decltype(false_), N const& n, Xs&& xs) {
+            return hana::drop(hana::pred(n),
+                              hana::tail(detail::std::forward<Xs>(xs)));
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const& n, Xs&& xs) {
+            constexpr bool done = hana::value<N>() == 0 ||
+                                  iterable_detail::is_empty_t<Xs>{};
+            return drop_helper(bool_<done>, n, detail::std::forward<Xs>(xs));
         }
     };
 
@@ -179,39 +221,44 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // drop_while
     //////////////////////////////////////////////////////////////////////////
-    namespace iterable_detail {
-        struct drop_while_helper {
-            struct next {
-                template <typename Xs, typename Pred>
-                constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
-                    return hana::drop_while(
-                        hana::tail(detail::std::forward<Xs>(xs)),
-                        detail::std::forward<Pred>(pred)
-                    );
-                }
-            };
-
-            template <typename Xs, typename Pred>
-            constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
-                return hana::eval_if(pred(hana::head(xs)),
-                    hana::lazy(next{})(xs, pred),
-                    hana::lazy(xs)
-                );
-            }
-        };
-    }
-
     template <typename It, typename>
     struct drop_while_impl : drop_while_impl<It, when<true>> { };
 
     template <typename It, bool condition>
     struct drop_while_impl<It, when<condition>> : default_ {
         template <typename Xs, typename Pred>
-        static constexpr auto apply(Xs xs, Pred pred) {
-            return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(xs),
-                hana::lazy(iterable_detail::drop_while_helper{})(xs, pred)
+        static constexpr auto drop_helper(decltype(false_), Xs&& xs, Pred&&)
+        { return detail::std::forward<Xs>(xs); }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        drop_helper(decltype(true_), Xs&& xs, Pred&& pred) {
+            return hana::drop_while(hana::tail(detail::std::forward<Xs>(xs)),
+                                    detail::std::forward<Pred>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto
+        drop_while_helper(decltype(true_), Xs&& xs, Pred&&)
+        { return detail::std::forward<Xs>(xs); }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        drop_while_helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            auto cond = pred(hana::head(xs));
+            constexpr bool drop_head = hana::if_(
+                hana::value<decltype(cond)>(), true, false
             );
+            return drop_helper(bool_<drop_head>,
+                               detail::std::forward<Xs>(xs),
+                               detail::std::forward<Pred>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return drop_while_helper(iterable_detail::is_empty_t<Xs>{},
+                                     detail::std::forward<Xs>(xs),
+                                     detail::std::forward<Pred>(pred));
         }
     };
 
@@ -247,73 +294,79 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Model of Foldable
     //////////////////////////////////////////////////////////////////////////
-    namespace iterable_detail {
-        struct foldl_helper {
-            template <typename F, typename X>
-            constexpr decltype(auto) operator()(F&& f, X&& x) const {
-                decltype(auto) state = hana::first(detail::std::forward<X>(x));
-                decltype(auto) xs = hana::second(detail::std::forward<X>(x));
-                return hana::pair(
-                    detail::std::forward<F>(f)(
-                        detail::std::forward<decltype(state)>(state),
-                        hana::head(xs)
-                    ),
-                    hana::tail(xs)
-                );
-            }
-        };
-
-        struct foldr_helper {
-            template <typename Xs, typename S, typename F>
-            constexpr decltype(auto) operator()(Xs&& xs, S&& s, F&& f) const {
-                return f(
-                    hana::head(xs),
-                    hana::foldr(hana::tail(xs), detail::std::forward<S>(s), f)
-                );
-            }
-        };
-
-        struct foldr1_helper {
-            template <typename Xs, typename F>
-            constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
-                return f(hana::head(xs), hana::foldr1(hana::tail(xs), f));
-            }
-        };
-    } // end namespace iterable_detail
-
     template <typename It>
     struct Iterable::foldl_impl {
+        template <typename Xs, typename State, typename F>
+        static constexpr auto
+        foldl_helper(decltype(true_), Xs&&, State&& s, F&&)
+        { return detail::std::forward<State>(s); }
+
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        foldl_helper(decltype(false_), Xs&& xs, State&& s, F&& f) {
+            auto ys = hana::uncons(detail::std::forward<Xs>(xs));
+            return apply(hana::second(detail::std::move(ys)),
+                         f(detail::std::forward<State>(s),
+                           hana::first(detail::std::move(ys))),
+                         f);
+        }
+
         template <typename Xs, typename State, typename F>
         static constexpr decltype(auto) apply(Xs&& xs, State&& s, F&& f) {
-            return hana::first(hana::until(
-                hana::compose(is_empty, second),
-                hana::pair(detail::std::forward<State>(s),
-                           detail::std::forward<Xs>(xs)),
-                hana::partial(iterable_detail::foldl_helper{},
-                                                detail::std::forward<F>(f))
-            ));
+            return foldl_helper(iterable_detail::is_empty_t<Xs>{},
+                                detail::std::forward<Xs>(xs),
+                                detail::std::forward<State>(s),
+                                detail::std::forward<F>(f));
         }
     };
 
     template <typename It>
     struct Iterable::foldr_impl {
         template <typename Xs, typename State, typename F>
-        static constexpr auto apply(Xs xs, State s, F f) {
-            return hana::eval_if(hana::is_empty(xs),
-                hana::lazy(s),
-                hana::lazy(iterable_detail::foldr_helper{})(xs, s, f)
-            );
+        static constexpr auto
+        foldr_helper(decltype(true_), Xs&&, State&& s, F&&)
+        { return detail::std::forward<State>(s); }
+
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto)
+        foldr_helper(decltype(false_), Xs&& xs, State&& s, F&& f) {
+            auto ys = hana::uncons(detail::std::forward<Xs>(xs));
+            return f(hana::first(detail::std::move(ys)),
+                     apply(hana::second(detail::std::move(ys)),
+                           detail::std::forward<State>(s), f));
+        }
+
+        template <typename Xs, typename State, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, State&& s, F&& f) {
+            return foldr_helper(iterable_detail::is_empty_t<Xs>{},
+                                detail::std::forward<Xs>(xs),
+                                detail::std::forward<State>(s),
+                                detail::std::forward<F>(f));
         }
     };
 
     template <typename It>
     struct Iterable::foldr1_impl {
+        template <typename X, typename Xs, typename F>
+        static constexpr auto
+        foldr1_helper(decltype(true_), X&& x, Xs&&, F&&)
+        { return detail::std::forward<X>(x); }
+
+        template <typename X, typename Xs, typename F>
+        static constexpr decltype(auto)
+        foldr1_helper(decltype(false_), X&& x, Xs&& xs, F&& f) {
+            return f(detail::std::forward<X>(x),
+                     apply(detail::std::forward<Xs>(xs), f));
+        }
+
         template <typename Xs, typename F>
-        static constexpr auto apply(Xs xs, F f) {
-            return hana::eval_if(hana::is_empty(hana::tail(xs)),
-                hana::lazy(hana::head)(xs),
-                hana::lazy(iterable_detail::foldr1_helper{})(xs, f)
-            );
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            auto ys = hana::uncons(detail::std::forward<Xs>(xs));
+            using Rest = decltype(hana::second(detail::std::move(ys)));
+            return foldr1_helper(iterable_detail::is_empty_t<Rest>{},
+                                 hana::first(detail::std::move(ys)),
+                                 hana::second(detail::std::move(ys)),
+                                 detail::std::forward<F>(f));
         }
     };
 
@@ -321,8 +374,10 @@ namespace boost { namespace hana {
     struct Iterable::foldl1_impl {
         template <typename Xs, typename F>
         static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
-            return hana::foldl(hana::tail(xs), hana::head(xs),
-                        detail::std::forward<F>(f));
+            auto ys = hana::uncons(detail::std::forward<Xs>(xs));
+            return hana::foldl(hana::second(detail::std::move(ys)),
+                               hana::first(detail::std::move(ys)),
+                               detail::std::forward<F>(f));
         }
     };
 
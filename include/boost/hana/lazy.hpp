@@ -151,18 +151,18 @@ namespace boost { namespace hana {
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
         apply(_lazy_apply<F, detail::closure_impl<Args...>> const& expr)
-        { return expr.function(static_cast<Args const&>(expr.args).get...); }
+        { return expr.function(static_cast<Args const&>(expr.args).get()...); }
 
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
         apply(_lazy_apply<F, detail::closure_impl<Args...>>& expr)
-        { return expr.function(static_cast<Args&>(expr.args).get...); }
+        { return expr.function(static_cast<Args&>(expr.args).get()...); }
 
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
         apply(_lazy_apply<F, detail::closure_impl<Args...>>&& expr) {
             return detail::std::move(expr.function)(
-                                    static_cast<Args&&>(expr.args).get...);
+                                    static_cast<Args&&>(expr.args).get()...);
         }
 
         // _lazy_value
@@ -21,11 +21,15 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/canonical_constant.hpp>
+#include <boost/hana/detail/std/decay.hpp>
 #include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/enable_if.hpp>
 #include <boost/hana/detail/std/forward.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/detail/std/is_arithmetic.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/void_t.hpp>
 #include <boost/hana/detail/variadic/foldl.hpp>
 #include <boost/hana/functional/always.hpp>
 #include <boost/hana/functional/compose.hpp>
@@ -233,10 +237,44 @@ namespace boost { namespace hana {
         { return static_cast<Cond>(cond ? false : true); }
     };
 
+    namespace logical_detail {
+        // Whether `f(state)` returns a new state of exactly the same type
+        // which can be assigned to the current state, in which case a
+        // runtime loop can be iterated without recursion.
+        template <typename F, typename State, typename = void>
+        struct preserves_state : detail::std::false_type { };
+
+        template <typename F, typename State>
+        struct preserves_state<F, State, detail::std::void_t<
+            decltype(detail::std::declval<State&>() =
+                detail::std::declval<F&>()(detail::std::declval<State>()))
+        >>
+            : detail::std::is_same<
+                decltype(detail::std::declval<F&>()(detail::std::declval<State>())),
+                State
+            >
+        { };
+
+        template <typename F, typename State>
+        using iterate = _integral_constant<bool, preserves_state<
+            F, typename detail::std::decay<State>::type
+        >{}>;
+    }
+
     template <typename L>
     struct while_impl<L, when<detail::std::is_arithmetic<L>{}>> {
         template <typename Pred, typename State, typename F>
-        static auto apply(Pred&& pred, State&& state, F&& f)
+        static typename detail::std::decay<State>::type
+        while_helper(decltype(true_), Pred&& pred, State&& state, F&& f) {
+            typename detail::std::decay<State>::type s =
+                                        detail::std::forward<State>(state);
+            while (pred(s))
+                s = f(detail::std::move(s));
+            return s;
+        }
+
+        template <typename Pred, typename State, typename F>
+        static auto while_helper(decltype(false_), Pred&& pred, State&& state, F&& f)
             -> decltype(
                 true ? f(detail::std::forward<State>(state))
                      : detail::std::forward<State>(state)
@@ -252,6 +290,44 @@ namespace boost { namespace hana {
                 return detail::std::forward<State>(state);
             }
         }
+
+        template <typename Pred, typename State, typename F>
+        static decltype(auto) apply(Pred&& pred, State&& state, F&& f) {
+            return while_helper(logical_detail::iterate<F, State>{},
+                                detail::std::forward<Pred>(pred),
+                                detail::std::forward<State>(state),
+                                detail::std::forward<F>(f));
+        }
+    };
+
+    template <typename L>
+    struct until_impl<L, when<detail::std::is_arithmetic<L>{}>> {
+        template <typename Pred, typename State, typename F>
+        static typename detail::std::decay<State>::type
+        until_helper(decltype(true_), Pred&& pred, State&& state, F&& f) {
+            typename detail::std::decay<State>::type s =
+                                        detail::std::forward<State>(state);
+            while (!pred(s))
+                s = f(detail::std::move(s));
+            return s;
+        }
+
+        template <typename Pred, typename State, typename F>
+        static decltype(auto)
+        until_helper(decltype(false_), Pred&& pred, State&& state, F&& f) {
+            return hana::while_(
+                    hana::compose(not_, detail::std::forward<Pred>(pred)),
+                    detail::std::forward<State>(state),
+                    detail::std::forward<F>(f));
+        }
+
+        template <typename Pred, typename State, typename F>
+        static decltype(auto) apply(Pred&& pred, State&& state, F&& f) {
+            return until_helper(logical_detail::iterate<F, State>{},
+                                detail::std::forward<Pred>(pred),
+                                detail::std::forward<State>(state),
+                                detail::std::forward<F>(f));
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -264,18 +340,19 @@ namespace boost { namespace hana {
         template <typename Then, typename Else>
         static constexpr auto
         eval_if_helper(decltype(true_), Then t, Else e)
-        { return hana::eval(t); }
+        { return hana::eval(detail::std::move(t)); }
 
         template <typename Then, typename Else>
         static constexpr auto
         eval_if_helper(decltype(false_), Then t, Else e)
-        { return hana::eval(e); }
+        { return hana::eval(detail::std::move(e)); }
 
         template <typename Cond, typename Then, typename Else>
         static constexpr decltype(auto) apply(Cond const&, Then t, Else e) {
             constexpr auto cond = hana::value<Cond>();
             constexpr bool truth_value = hana::if_(cond, true, false);
-            return eval_if_helper(bool_<truth_value>, t, e);
+            return eval_if_helper(bool_<truth_value>, detail::std::move(t),
+                                                      detail::std::move(e));
         }
     };
 
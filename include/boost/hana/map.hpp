@@ -19,15 +19,28 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/string_table.hpp>
+#include <boost/hana/detail/type_index.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
-#include <boost/hana/functional/demux.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/product.hpp>
 #include <boost/hana/record.hpp>
 #include <boost/hana/searchable.hpp>
@@ -39,8 +52,23 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // _map
     //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        template <typename Pair>
+        struct key_type {
+            using type = typename detail::std::decay<decltype(
+                hana::first(detail::std::declval<Pair>())
+            )>::type;
+        };
+
+        template <typename K, typename V>
+        struct key_type<_pair<K, V>> { using type = K; };
+    }
+
     template <typename ...Pairs>
-    struct _map : operators::adl {
+    struct _map
+        : operators::adl
+        , detail::type_index<typename map_detail::key_type<Pairs>::type...>
+    {
         _tuple<Pairs...> storage;
         using hana = _map;
         using datatype = Map;
@@ -98,16 +126,26 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Comparable
     //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        template <typename M>
+        struct has_same_value {
+            M const& map;
+
+            template <typename Pair>
+            constexpr auto operator()(Pair const& pair) const {
+                return hana::equal(hana::find(map, hana::first(pair)),
+                                   hana::just(hana::second(pair)));
+            }
+        };
+    }
+
     template <>
     struct equal_impl<Map, Map> {
         template <typename M1, typename M2>
         static constexpr auto apply(M1 const& m1, M2 const& m2) {
             return hana::and_(
                 hana::equal(hana::length(m1.storage), hana::length(m2.storage)),
-                hana::all_of(hana::keys(m1), hana::demux(equal)(
-                    hana::partial(find, m1),
-                    hana::partial(find, m2)
-                ))
+                hana::all_of(m1.storage, map_detail::has_same_value<M2>{m2})
             );
         }
     };
@@ -127,6 +165,76 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct find_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto
+        helper(M&& map, Key&&,
+               detail::std::integral_constant<detail::std::size_t, i>) {
+            return hana::just(hana::second(detail::get<i>(
+                                detail::std::forward<M>(map).storage)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto helper(M&&, Key&&, decltype(true_))
+        { return nothing; }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto)
+        helper(M&& map, Key&& key, decltype(false_)) {
+            return hana::find_if(detail::std::forward<M>(map),
+                    hana::equal.to(detail::std::forward<Key>(key)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key) {
+            using K = typename detail::std::decay<Key>::type;
+            using Found = detail::index_of_type<M, K>;
+            using Miss = detail::has_identity_equality<K>;
+            return helper(detail::std::forward<M>(map),
+                          detail::std::forward<Key>(key),
+                          typename detail::std::conditional<
+                            detail::std::is_same<Found, void>{},
+                            decltype(bool_<Miss{}>),
+                            Found
+                          >::type{});
+        }
+    };
+
+    template <>
+    struct elem_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto
+        helper(M&&, Key&&,
+               detail::std::integral_constant<detail::std::size_t, i>)
+        { return true_; }
+
+        template <typename M, typename Key>
+        static constexpr auto helper(M&&, Key&&, decltype(true_))
+        { return false_; }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto)
+        helper(M&& map, Key&& key, decltype(false_)) {
+            return hana::any_of(detail::std::forward<M>(map),
+                    hana::equal.to(detail::std::forward<Key>(key)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key) {
+            using K = typename detail::std::decay<Key>::type;
+            using Found = detail::index_of_type<M, K>;
+            using Miss = detail::has_identity_equality<K>;
+            return helper(detail::std::forward<M>(map),
+                          detail::std::forward<Key>(key),
+                          typename detail::std::conditional<
+                            detail::std::is_same<Found, void>{},
+                            decltype(bool_<Miss{}>),
+                            Found
+                          >::type{});
+        }
+    };
+
     template <>
     struct any_of_impl<Map> {
         template <typename M, typename Pred>
@@ -176,6 +284,89 @@ namespace boost { namespace hana {
         static constexpr decltype(auto) apply(M&& m)
         { return hana::to<S>(detail::std::forward<M>(m).storage); }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // frozen_lookup
+    //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        // Table of functions calling `f` with the `i`-th value of a map,
+        // used to go from the runtime index of a key to its value.
+        template <typename M, typename F, typename Indices>
+        struct value_dispatcher;
+
+        template <typename ...Pairs, typename F, detail::std::size_t ...i>
+        struct value_dispatcher<_map<Pairs...>, F,
+                                detail::std::index_sequence<i...>>
+        {
+            template <detail::std::size_t j>
+            static void call(_map<Pairs...> const& map, F& f)
+            { f(hana::second(detail::get<j>(map.storage))); }
+
+            static constexpr detail::std::size_t size =
+                sizeof...(i) == 0 ? 1 : sizeof...(i);
+
+            using function = void(*)(_map<Pairs...> const&, F&);
+            static constexpr function table[size] = {&call<i>...};
+        };
+
+        template <typename ...Pairs, typename F, detail::std::size_t ...i>
+        constexpr typename value_dispatcher<
+            _map<Pairs...>, F, detail::std::index_sequence<i...>
+        >::function value_dispatcher<
+            _map<Pairs...>, F, detail::std::index_sequence<i...>
+        >::table[];
+    }
+
+    template <typename M>
+    struct _frozen_lookup;
+
+    template <typename ...Pairs>
+    struct _frozen_lookup<_map<Pairs...>> {
+        _map<Pairs...> map;
+
+        static constexpr detail::std::size_t n = sizeof...(Pairs);
+
+        template <typename Pair>
+        using key = typename map_detail::key_type<Pair>::type;
+
+        using table = detail::string_table<key<Pairs>...>;
+
+        static_assert(table::distinct,
+        "hana::frozen_lookup(map) requires the keys of the map to be distinct");
+
+        template <typename F>
+        bool operator()(char const* str, detail::std::size_t length,
+                        F&& f) const
+        {
+            detail::std::size_t i = table::find(str, length);
+            if (i == n)
+                return false;
+
+            using Dispatcher = map_detail::value_dispatcher<
+                _map<Pairs...>,
+                typename detail::std::remove_reference<F>::type,
+                detail::std::make_index_sequence<n>
+            >;
+            Dispatcher::table[i](map, f);
+            return true;
+        }
+
+        template <typename F>
+        bool operator()(char const* str, F&& f) const {
+            detail::std::size_t length = 0;
+            while (str[length] != '\0')
+                ++length;
+            return (*this)(str, length, detail::std::forward<F>(f));
+        }
+    };
+
+    //! @cond
+    template <typename Map>
+    constexpr auto _frozen_lookup_fn::operator()(Map&& map) const {
+        using M = typename detail::std::decay<Map>::type;
+        return _frozen_lookup<M>{detail::std::forward<Map>(map)};
+    }
+    //! @endcond
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_MAP_HPP
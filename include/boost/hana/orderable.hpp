@@ -24,8 +24,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/wrong.hpp>
 #include <boost/hana/detail/has_common_embedding.hpp>
 #include <boost/hana/detail/less_than_comparable.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/enable_if.hpp>
 #include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/functional/flip.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/logical.hpp>
@@ -246,6 +248,59 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // compare
+    //////////////////////////////////////////////////////////////////////////
+    namespace orderable_detail {
+        template <typename X, typename Y>
+        using less_t = decltype(hana::less(detail::std::declval<X const&>(),
+                                           detail::std::declval<Y const&>()));
+
+        // Whether both `less(x, y)` and `less(y, x)` are `Constant`s, in
+        // which case the result of `compare` can be a `Constant` too.
+        template <typename X, typename Y>
+        using constant_order = detail::std::integral_constant<bool,
+            _models<Constant, typename datatype<less_t<X, Y>>::type>{} &&
+            _models<Constant, typename datatype<less_t<Y, X>>::type>{}
+        >;
+    }
+
+    template <typename T, typename U, typename>
+    struct compare_impl : compare_impl<T, U, when<true>> { };
+
+    template <typename T, typename U, bool condition>
+    struct compare_impl<T, U, when<condition>> : default_ {
+        template <typename X, typename Y>
+        static constexpr auto helper(X const&, Y const&, detail::std::true_type) {
+            constexpr bool less = hana::value<orderable_detail::less_t<X, Y>>();
+            constexpr bool greater = hana::value<orderable_detail::less_t<Y, X>>();
+            return int_<less ? -1 : greater ? 1 : 0>;
+        }
+
+        template <typename X, typename Y>
+        static constexpr int helper(X const& x, Y const& y, detail::std::false_type) {
+            return hana::if_(hana::less(x, y), true, false) ? -1 :
+                   hana::if_(hana::less(y, x), true, false) ? 1 : 0;
+        }
+
+        template <typename X, typename Y>
+        static constexpr decltype(auto) apply(X const& x, Y const& y)
+        { return helper(x, y, orderable_detail::constant_order<X, Y>{}); }
+    };
+
+    // Cross-type overload
+    template <typename T, typename U>
+    struct compare_impl<T, U, when<
+        detail::has_nontrivial_common_embedding<Orderable, T, U>{}
+    >> {
+        using C = typename common<T, U>::type;
+        template <typename X, typename Y>
+        static constexpr decltype(auto) apply(X&& x, Y&& y) {
+            return hana::compare(hana::to<C>(detail::std::forward<X>(x)),
+                                 hana::to<C>(detail::std::forward<Y>(y)));
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // ordering
     //////////////////////////////////////////////////////////////////////////
@@ -314,6 +369,23 @@ namespace boost { namespace hana {
                               hana::not_(hana::less(y, x)));
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable::less_impl
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename U>
+    struct Orderable::less_impl {
+        template <int order>
+        static constexpr auto helper(_integral_constant<int, order>)
+        { return bool_<(order < 0)>; }
+
+        static constexpr bool helper(int order)
+        { return order < 0; }
+
+        template <typename X, typename Y>
+        static constexpr decltype(auto) apply(X const& x, Y const& y)
+        { return helper(hana::compare(x, y)); }
+    };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_ORDERABLE_HPP
@@ -0,0 +1,318 @@
+/*!
+@file
+Defines `boost::hana::PackedTuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_PACKED_TUPLE_HPP
+#define BOOST_HANA_PACKED_TUPLE_HPP
+
+#include <boost/hana/fwd/packed_tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/variadic/foldl.hpp>
+#include <boost/hana/detail/variadic/foldr.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/partial.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/monad_plus.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // _packed_tuple
+    //////////////////////////////////////////////////////////////////////////
+    namespace packed_tuple_detail {
+        using Size = detail::std::size_t;
+
+        // Tells whether the `i`-th element should be stored before the
+        // `j`-th element, which is when it requires a stricter alignment.
+        // Since the sort is stable, elements with the same alignment are
+        // stored in the order in which they are given.
+        template <typename ...X>
+        struct by_alignment {
+            detail::array<Size, sizeof...(X)> alignments = {{alignof(X)...}};
+
+            constexpr bool operator()(Size i, Size j) const
+            { return alignments[i] > alignments[j]; }
+        };
+
+        // The logical indices of the elements, in the order in which they
+        // are stored.
+        template <typename ...X>
+        using order = detail::generate_index_sequence<sizeof...(X),
+            sort_by_impl<Tuple>::sorted_indices<by_alignment<X...>>
+        >;
+
+        template <Size n, typename Xn>
+        detail::element<n, Xn> element_at(detail::element<n, Xn> const*);
+
+        template <typename Order, typename ...X>
+        struct make_storage;
+
+        // The storage is a `closure_impl` whose bases are the same
+        // `element<i, Xi>`s as those of a `closure<X...>`, but listed in
+        // storage order. Since each element is still tagged with its logical
+        // index, `detail::get<i>` keeps working with logical indices.
+        template <Size ...k, typename ...X>
+        struct make_storage<detail::std::index_sequence<k...>, X...> {
+            using type = detail::closure_impl<
+                decltype(packed_tuple_detail::element_at<k>(
+                    static_cast<detail::closure<X...> const*>(nullptr)
+                ))...
+            >;
+        };
+
+        template <typename ...X>
+        using storage = typename make_storage<order<X...>, X...>::type;
+
+        struct from_storage_order { };
+    }
+
+    // Like for `_tuple`, we do not inherit from `operators::adl`, since
+    // `operators::Iterable_ops` already makes the operators visible to ADL.
+    template <typename ...Xs>
+    struct _packed_tuple
+        : packed_tuple_detail::storage<Xs...>
+        , operators::Iterable_ops<_packed_tuple<Xs...>>
+    {
+        using operators::Iterable_ops<_packed_tuple<Xs...>>::operator[];
+
+        _packed_tuple() = default;
+
+        // The objects must be given in storage order; use
+        // `make<PackedTuple>` to create a packed tuple from objects
+        // in logical order.
+        template <typename ...Ys>
+        explicit constexpr
+        _packed_tuple(packed_tuple_detail::from_storage_order, Ys&& ...ys)
+            : packed_tuple_detail::storage<Xs...>(detail::std::forward<Ys>(ys)...)
+        { }
+
+        using hana = _packed_tuple;
+        using datatype = PackedTuple;
+
+        static constexpr detail::std::size_t size = sizeof...(Xs);
+    };
+
+    template <>
+    struct operators::of<PackedTuple>
+        : operators::of<Comparable, Orderable, Iterable>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace packed_tuple_detail {
+        template <typename Xs>
+        using size = _integral_constant<Size,
+            detail::std::remove_reference<Xs>::type::size
+        >;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<PackedTuple> {
+        template <typename P, detail::std::size_t ...k, typename Refs>
+        static constexpr P make_helper(detail::std::index_sequence<k...>,
+                                       Refs&& refs)
+        {
+            return P{packed_tuple_detail::from_storage_order{},
+                     detail::get<k>(static_cast<Refs&&>(refs))...};
+        }
+
+        template <typename ...Xs>
+        static constexpr auto apply(Xs&& ...xs) {
+            using P = _packed_tuple<typename detail::std::decay<Xs>::type...>;
+            return make_helper<P>(
+                packed_tuple_detail::order<typename detail::std::decay<Xs>::type...>{},
+                detail::closure<Xs&&...>{detail::std::forward<Xs>(xs)...}
+            );
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<PackedTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::std::forward<F>(f)(
+                detail::get<i>(detail::std::forward<Xs>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = packed_tuple_detail::size<Xs>{};
+            return unpack_helper(detail::std::forward<Xs>(xs),
+                                 detail::std::forward<F>(f),
+                                 detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    template <>
+    struct foldl_impl<PackedTuple> {
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return hana::unpack(detail::std::forward<Xs>(xs),
+                hana::partial(detail::variadic::foldl,
+                              detail::std::forward<F>(f),
+                              detail::std::forward<S>(s)));
+        }
+    };
+
+    template <>
+    struct foldr_impl<PackedTuple> {
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return hana::unpack(detail::std::forward<Xs>(xs),
+                hana::partial(detail::variadic::foldr,
+                              detail::std::forward<F>(f),
+                              detail::std::forward<S>(s)));
+        }
+    };
+
+    template <>
+    struct length_impl<PackedTuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<Xs::size>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct head_impl<PackedTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return detail::get<0>(detail::std::forward<Xs>(xs)); }
+    };
+
+    template <>
+    struct at_impl<PackedTuple> {
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr detail::std::size_t index = hana::value<N>();
+            return detail::get<index>(detail::std::forward<Xs>(xs));
+        }
+    };
+
+    template <>
+    struct last_impl<PackedTuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = packed_tuple_detail::size<Xs>{};
+            return detail::get<size - 1>(detail::std::forward<Xs>(xs));
+        }
+    };
+
+    template <>
+    struct tail_impl<PackedTuple> {
+        template <typename Xs, detail::std::size_t ...i>
+        static constexpr auto
+        tail_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<PackedTuple>(
+                detail::get<i + 1>(detail::std::forward<Xs>(xs))...
+            );
+        }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs&& xs) {
+            constexpr detail::std::size_t size = packed_tuple_detail::size<Xs>{};
+            return tail_helper(detail::std::forward<Xs>(xs),
+                               detail::std::make_index_sequence<size - 1>{});
+        }
+    };
+
+    template <>
+    struct is_empty_impl<PackedTuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return bool_<Xs::size == 0>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<PackedTuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr auto
+        transform_helper(Xs&& xs, F& f, detail::std::index_sequence<i...>) {
+            return hana::make<PackedTuple>(
+                f(detail::get<i>(detail::std::forward<Xs>(xs)))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = packed_tuple_detail::size<Xs>{};
+            return transform_helper(detail::std::forward<Xs>(xs), f,
+                                    detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct empty_impl<PackedTuple> {
+        static constexpr _packed_tuple<> apply()
+        { return {}; }
+    };
+
+    template <>
+    struct prepend_impl<PackedTuple> {
+        template <typename X, typename Xs, detail::std::size_t ...i>
+        static constexpr auto
+        prepend_helper(X&& x, Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<PackedTuple>(detail::std::forward<X>(x),
+                detail::get<i>(detail::std::forward<Xs>(xs))...);
+        }
+
+        template <typename X, typename Xs>
+        static constexpr auto apply(X&& x, Xs&& xs) {
+            constexpr detail::std::size_t size = packed_tuple_detail::size<Xs>{};
+            return prepend_helper(detail::std::forward<X>(x),
+                                  detail::std::forward<Xs>(xs),
+                                  detail::std::make_index_sequence<size>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct models_impl<Sequence, PackedTuple>
+        : decltype(true_)
+    { };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_PACKED_TUPLE_HPP
@@ -15,8 +15,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/comparable.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/has_unique_bytes.hpp>
 #include <boost/hana/detail/std/decay.hpp>
 #include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/orderable.hpp>
 #include <boost/hana/product.hpp>
 
@@ -80,6 +82,18 @@ namespace boost { namespace hana {
         static constexpr decltype(auto) apply(P&& p)
         { return detail::std::forward<P>(p).second; }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // has_unique_bytes
+    //////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename First, typename Second>
+        struct has_unique_bytes<_pair<First, Second>, Pair>
+            : detail::std::integral_constant<bool,
+                detail::packed<_pair<First, Second>, First, Second>()
+            >
+        { };
+    }
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_PAIR_HPP
@@ -19,14 +19,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/std/common_type.hpp>
 #include <boost/hana/detail/std/forward.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/tuple_cartesian_product.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/integral_constant.hpp> // required by fwd decl and below
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/maybe.hpp>
 #include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
 
 
 namespace boost { namespace hana {
@@ -301,6 +306,114 @@ namespace boost { namespace hana {
             >{};
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // dispatch
+    //////////////////////////////////////////////////////////////////////////
+    namespace range_detail {
+        template <typename Point, typename F>
+        void dispatch_call(F& f)
+        { hana::unpack(Point{}, f); }
+
+        // Table of functions with one entry per point of the cartesian
+        // product, in row-major order.
+        template <typename F, typename Points>
+        struct dispatch_table;
+
+        template <typename F, typename ...Points>
+        struct dispatch_table<F, _tuple<Points...>> {
+            static constexpr void (*table[])(F&) = {
+                &dispatch_call<Points, F>...
+            };
+
+            static void apply(detail::std::size_t index, F& f)
+            { table[index](f); }
+        };
+
+        template <typename F, typename ...Points>
+        constexpr void (*dispatch_table<F, _tuple<Points...>>::table[])(F&);
+
+        // When any of the ranges is empty, no value is ever in bounds.
+        template <typename F>
+        struct dispatch_table<F, _tuple<>> {
+            static void apply(detail::std::size_t, F&) { }
+        };
+
+        // Whether `x < y`, comparing the values of `x` and `y` instead of
+        // their values after the usual arithmetic conversions, which would
+        // make `-1 < 0u` false.
+        template <typename X, typename Y>
+        constexpr bool value_less(X x, Y y) {
+            using C = typename detail::std::common_type<X, Y>::type;
+            bool const x_negative = x < X{0};
+            bool const y_negative = y < Y{0};
+            if (x_negative != y_negative)
+                return x_negative;
+            return static_cast<C>(x) < static_cast<C>(y);
+        }
+
+        // Accumulates the row-major index of `v` in the range `R`, or
+        // returns false if `v` is not in `R`. The bounds are checked before
+        // `v` is converted to the type of `R`, so values that would wrap
+        // around into the range are rejected.
+        template <typename R, typename V>
+        bool linearize(detail::std::size_t& index, V const& v) {
+            using T = typename R::underlying::value_type;
+            if (range_detail::value_less(+v, R::from) ||
+                !range_detail::value_less(+v, R::to))
+                return false;
+            T const t = static_cast<T>(v);
+            index = index * static_cast<detail::std::size_t>(R::to - R::from)
+                  + static_cast<detail::std::size_t>(t - R::from);
+            return true;
+        }
+
+        template <typename ...R>
+        struct dispatcher {
+            using Points = decltype(detail::tuple_cartesian_product(
+                hana::unpack(R{}, hana::make_tuple)...
+            ));
+
+            template <typename Values, typename F, detail::std::size_t ...i>
+            static bool apply(Values const& values, F& f,
+                              detail::std::index_sequence<i...>)
+            {
+                detail::std::size_t index = 0;
+                bool const in_bounds[] = {
+                    range_detail::linearize<R>(index, detail::get<i>(values))...
+                };
+                for (bool b : in_bounds)
+                    if (!b)
+                        return false;
+                dispatch_table<F, Points>::apply(index, f);
+                return true;
+            }
+        };
+    }
+
+    template <typename C, typename C::value_type from,
+                          typename C::value_type to,
+              typename V, typename F>
+    bool _dispatch::operator()(_range<C, from, to> const& range,
+                               V const& value, F&& f) const
+    {
+        return (*this)(hana::make_tuple(range), hana::make_tuple(value),
+                       detail::std::forward<F>(f));
+    }
+
+    template <typename ...R, typename ...V, typename F>
+    bool _dispatch::operator()(_tuple<R...> const& ranges,
+                               _tuple<V...> const& values, F&& f) const
+    {
+        static_assert(sizeof...(R) != 0,
+        "hana::dispatch(ranges, values, f) requires at least one range");
+        static_assert(sizeof...(R) == sizeof...(V),
+        "hana::dispatch(ranges, values, f) requires as many values as "
+        "there are ranges");
+
+        return range_detail::dispatcher<R...>::apply(values, f,
+            detail::std::make_index_sequence<sizeof...(R)>{});
+    }
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_RANGE_HPP
@@ -14,14 +14,30 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/bool.hpp>
 #include <boost/hana/comparable.hpp>
+#include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/first_difference.hpp>
+#include <boost/hana/detail/has_unique_bytes.hpp>
+#include <boost/hana/detail/less_than_comparable.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
 #include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/string_table.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
-#include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/orderable.hpp>
 #include <boost/hana/product.hpp>
 #include <boost/hana/searchable.hpp>
 
@@ -56,45 +72,213 @@ namespace boost { namespace hana {
         : R::hana::members_impl
     { };
 
+    //////////////////////////////////////////////////////////////////////////
+    // has_unique_bytes
+    //////////////////////////////////////////////////////////////////////////
+    namespace record_detail {
+        template <typename R>
+        struct packed_members {
+            template <typename ...Members>
+            constexpr auto operator()(Members&& ...) const {
+                return detail::std::integral_constant<bool, detail::packed<R,
+                    typename detail::std::decay<decltype(
+                        hana::second(detail::std::declval<Members>())(
+                            detail::std::declval<R const&>()
+                        )
+                    )>::type...
+                >()>{};
+            }
+        };
+    }
+
+    namespace detail {
+        template <typename R>
+        struct has_unique_bytes<R, R,
+            detail::std::enable_if_t<_models<Record, R>{}>
+        >
+            : decltype(hana::unpack(members<R>(),
+                                    record_detail::packed_members<R>{}))
+        { };
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Model of Comparable
     //////////////////////////////////////////////////////////////////////////
     namespace record_detail {
+        // The objects are held by reference so they are not copied.
+        template <typename X, typename Y>
         struct compare_members_of {
-            template <typename X, typename Y, typename Member>
-            constexpr decltype(auto) operator()(X&& x, Y&& y, Member&& member) const {
+            X const& x;
+            Y const& y;
+
+            template <typename Member>
+            constexpr decltype(auto) operator()(Member&& member) const {
                 auto accessor = hana::second(detail::std::forward<Member>(member));
-                return hana::equal(accessor(detail::std::forward<X>(x)),
-                                   accessor(detail::std::forward<Y>(y)));
+                return hana::equal(accessor(x), accessor(y));
+            }
+        };
+
+        // Whether the records have members and comparing them only gives
+        // runtime `bool`s, in which case the result of `equal` can't be a
+        // `Constant` anyway.
+        template <typename X, typename Y>
+        struct compares_to_bool {
+            template <typename ...Members>
+            constexpr auto operator()(Members&& ...) const {
+                return detail::fast_and<sizeof...(Members) != 0,
+                    detail::std::is_same<decltype(hana::equal(
+                        hana::second(detail::std::declval<Members>())(
+                            detail::std::declval<X const&>()),
+                        hana::second(detail::std::declval<Members>())(
+                            detail::std::declval<Y const&>())
+                    )), bool>::value...
+                >{};
             }
         };
+
+        // Compares all the members in a single expression, without the
+        // intermediate results of `all_of`. Unless `bitwise`, the members
+        // are compared until the first difference. When `bitwise`, the
+        // members are integers covering all the bytes of the objects, so
+        // they are all compared without branching, which lets the compiler
+        // merge the comparisons into comparisons of whole words.
+        template <bool bitwise, typename X, typename Y>
+        struct equal_members {
+            X const& x;
+            Y const& y;
+
+            template <typename ...Members>
+            constexpr bool operator()(Members const& ...member) const {
+                bool result = true;
+                using swallow = bool[];
+                (void)swallow{true, (result = bitwise
+                    ? result & hana::equal(hana::second(member)(x),
+                                           hana::second(member)(y))
+                    : result && hana::equal(hana::second(member)(x),
+                                            hana::second(member)(y))
+                )...};
+                return result;
+            }
+        };
+
+        // How two records are compared:
+        // 0. With `all_of`, since the result may be a `Constant`.
+        // 1. With `equal_members<false>`.
+        // 2. With `equal_members<true>`.
+        template <typename R, typename X, typename Y>
+        using equal_kind = detail::std::integral_constant<int,
+            !decltype(hana::unpack(members<R>(), compares_to_bool<X, Y>{})){} ? 0 :
+            detail::std::is_same<X, Y>{} && detail::has_unique_bytes<X>{} ? 2 :
+            1
+        >;
     }
 
     template <typename R>
     struct equal_impl<R, R, when<_models<Record, R>{}>> {
         template <typename X, typename Y>
-        static constexpr decltype(auto) apply(X&& x, Y&& y) {
+        static constexpr decltype(auto)
+        helper(X const& x, Y const& y, detail::std::integral_constant<int, 0>) {
             return hana::all_of(members<R>(),
-                hana::partial(record_detail::compare_members_of{},
-                              detail::std::forward<X>(x),
-                              detail::std::forward<Y>(y)));
+                record_detail::compare_members_of<X, Y>{x, y});
+        }
+
+        template <typename X, typename Y, int kind>
+        static constexpr bool
+        helper(X const& x, Y const& y, detail::std::integral_constant<int, kind>) {
+            return hana::unpack(members<R>(),
+                record_detail::equal_members<kind == 2, X, Y>{x, y});
+        }
+
+        template <typename X, typename Y>
+        static constexpr decltype(auto) apply(X const& x, Y const& y)
+        { return helper(x, y, record_detail::equal_kind<R, X, Y>{}); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Model of Orderable
+    //////////////////////////////////////////////////////////////////////////
+    namespace record_detail {
+        template <typename X, typename Y, typename Member>
+        using order = typename detail::std::decay<decltype(hana::compare(
+            hana::second(detail::std::declval<Member>())(
+                detail::std::declval<X const&>()),
+            hana::second(detail::std::declval<Member>())(
+                detail::std::declval<Y const&>())
+        ))>::type;
+
+        // Compares the members in order, until the first difference. When
+        // comparing them only gives `Constant`s, the result is computed at
+        // compile-time.
+        template <typename X, typename Y>
+        struct compare_members {
+            X const& x;
+            Y const& y;
+
+            template <typename ...Members>
+            constexpr auto helper(detail::std::true_type, Members const& ...) const {
+                constexpr int orders[] = {
+                    0, static_cast<int>(hana::value<order<X, Y, Members const&>>())...
+                };
+                return int_<detail::first_difference(orders)>;
+            }
+
+            template <typename ...Members>
+            constexpr int
+            helper(detail::std::false_type, Members const& ...member) const {
+                int result = 0;
+                using swallow = int[];
+                (void)swallow{0, (result = result != 0 ? result :
+                    static_cast<int>(hana::compare(hana::second(member)(x),
+                                                   hana::second(member)(y)))
+                )...};
+                return result;
+            }
+
+            template <typename ...Members>
+            constexpr decltype(auto) operator()(Members const& ...member) const {
+                return helper(detail::fast_and<_models<Constant,
+                    typename datatype<order<X, Y, Members const&>>::type
+                >{}...>{}, member...);
+            }
+        };
+    }
+
+    template <typename R>
+    struct compare_impl<R, R, when<_models<Record, R>{}>> {
+        template <typename X, typename Y>
+        static constexpr decltype(auto) apply(X const& x, Y const& y) {
+            return hana::unpack(members<R>(),
+                record_detail::compare_members<X, Y>{x, y});
         }
     };
 
+    // Records which already define `operator<` keep using it.
+    template <typename R>
+    struct less_impl<R, R, when<
+        _models<Record, R>{} && !detail::concept::LessThanComparable<R>{}
+    >>
+        : Orderable::less_impl<R, R>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Model of Foldable
     //////////////////////////////////////////////////////////////////////////
     namespace record_detail {
         // This is equivalent to `demux`, except that `demux` can't forward
         // the `udt` because it does not know the `g`s are accessors. Hence,
-        // this can result in faster code.
+        // this can result in faster code. `F` and `Udt` are reference types,
+        // so neither the function nor the `udt` are copied, and the members
+        // are accessed in the original object.
+        template <typename F, typename Udt>
         struct almost_demux {
-            template <typename F, typename Udt, typename ...Members>
-            constexpr decltype(auto)
-            operator()(F&& f, Udt&& udt, Members&& ...g) const {
-                return detail::std::forward<F>(f)(
+            F f;
+            Udt udt;
+
+            template <typename ...Members>
+            constexpr decltype(auto) operator()(Members&& ...g) const {
+                return static_cast<F>(f)(
                     hana::second(detail::std::forward<Members>(g))(
-                        detail::std::forward<Udt>(udt)
+                        static_cast<Udt>(udt)
                     )...
                 );
             }
@@ -106,9 +290,10 @@ namespace boost { namespace hana {
         template <typename Udt, typename F>
         static constexpr decltype(auto) apply(Udt&& udt, F&& f) {
             return hana::unpack(hana::members<R>(),
-                hana::partial(record_detail::almost_demux{},
-                              detail::std::forward<F>(f),
-                              detail::std::forward<Udt>(udt)));
+                record_detail::almost_demux<F&&, Udt&&>{
+                    detail::std::forward<F>(f),
+                    detail::std::forward<Udt>(udt)
+                });
         }
     };
 
@@ -149,6 +334,119 @@ namespace boost { namespace hana {
                     hana::compose(detail::std::forward<Pred>(pred), first));
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // visit_member
+    //////////////////////////////////////////////////////////////////////////
+    namespace record_detail {
+        template <typename Key>
+        struct is_string : detail::std::false_type { };
+
+        template <char ...s>
+        struct is_string<_string<s...>> : detail::std::true_type { };
+
+        template <typename ...Keys>
+        struct key_table {
+            static_assert(detail::fast_and<is_string<Keys>::value...>{},
+            "hana::visit_member(r, name, f) requires the keys of the Record "
+            "to be compile-time Strings");
+
+            // An empty table is used on error, so that only the above
+            // message is shown.
+            using type = typename detail::std::conditional<
+                detail::fast_and<is_string<Keys>::value...>{},
+                detail::string_table<Keys...>,
+                detail::string_table<>
+            >::type;
+        };
+
+        struct make_key_table {
+            template <typename ...Members>
+            constexpr auto operator()(Members&& ...) const {
+                return key_table<typename detail::std::decay<
+                    decltype(hana::first(detail::std::declval<Members>()))
+                >::type...>{};
+            }
+        };
+
+        template <typename R>
+        using member_table = typename decltype(
+            hana::unpack(members<R>(), make_key_table{})
+        )::type;
+
+        // Table of functions calling `f` with the `i`-th member of a record,
+        // used to go from the runtime index of a key to the member. `Udt`
+        // is a reference type, so the member is accessed in the original
+        // object.
+        template <typename R, typename Udt, typename F, typename Indices>
+        struct member_dispatcher;
+
+        template <typename R, typename Udt, typename F,
+                  detail::std::size_t ...i>
+        struct member_dispatcher<R, Udt, F, detail::std::index_sequence<i...>> {
+            template <detail::std::size_t j>
+            static void call(Udt udt, F& f) {
+                f(hana::second(hana::at_c<j>(members<R>()))(
+                    static_cast<Udt>(udt)
+                ));
+            }
+
+            static constexpr detail::std::size_t size =
+                sizeof...(i) == 0 ? 1 : sizeof...(i);
+
+            using function = void(*)(Udt, F&);
+            static constexpr function table[size] = {&call<i>...};
+        };
+
+        template <typename R, typename Udt, typename F,
+                  detail::std::size_t ...i>
+        constexpr typename member_dispatcher<
+            R, Udt, F, detail::std::index_sequence<i...>
+        >::function member_dispatcher<
+            R, Udt, F, detail::std::index_sequence<i...>
+        >::table[];
+    }
+
+    //! @cond
+    template <typename Udt, typename F>
+    bool _visit_member::operator()(Udt&& udt, char const* str,
+                                   detail::std::size_t length, F&& f) const
+    {
+        using R = typename datatype<Udt>::type;
+        using Table = record_detail::member_table<R>;
+
+        static_assert(Table::distinct,
+        "hana::visit_member(r, name, f) requires the keys of the Record "
+        "to be distinct");
+
+        detail::std::size_t i = Table::find(str, length);
+        if (i == Table::n)
+            return false;
+
+        using Dispatcher = record_detail::member_dispatcher<
+            R, Udt&&, typename detail::std::remove_reference<F>::type,
+            detail::std::make_index_sequence<Table::n>
+        >;
+        Dispatcher::table[i](detail::std::forward<Udt>(udt), f);
+        return true;
+    }
+
+    template <typename Udt, typename F>
+    bool _visit_member::operator()(Udt&& udt, char const* str, F&& f) const {
+        detail::std::size_t length = 0;
+        while (str[length] != '\0')
+            ++length;
+        return (*this)(detail::std::forward<Udt>(udt), str, length,
+                       detail::std::forward<F>(f));
+    }
+
+    template <typename Udt, typename Name, typename F, typename>
+    bool _visit_member::operator()(Udt&& udt, Name const& name, F&& f) const {
+        return (*this)(detail::std::forward<Udt>(udt), name.data(),
+                       static_cast<detail::std::size_t>(name.size()),
+                       detail::std::forward<F>(f));
+    }
+    //! @endcond
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_RECORD_HPP
@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/enable_if.hpp>
 #include <boost/hana/detail/std/forward.hpp>
 #include <boost/hana/detail/std/is_arithmetic.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 
 // for default power
 #include <boost/hana/comparable.hpp>
@@ -95,19 +96,74 @@ namespace boost { namespace hana {
     template <typename R, typename>
     struct power_impl : power_impl<R, when<true>> { };
 
+    namespace ring_detail {
+        // Computes `x` to the `n`th power with O(log n) multiplications and
+        // template instantiations, by squaring `x` to the `n/2`th power.
+        template <typename R, detail::std::size_t n, bool = n % 2 != 0>
+        struct power_by_squaring;
+
+        template <typename R>
+        struct power_by_squaring<R, 0, false> {
+            template <typename X>
+            static constexpr auto apply(X const&)
+            { return hana::one<R>(); }
+        };
+
+        template <typename R>
+        struct power_by_squaring<R, 1, true> {
+            template <typename X>
+            static constexpr auto apply(X const& x)
+            { return x; }
+        };
+
+        template <typename R, detail::std::size_t n>
+        struct power_by_squaring<R, n, false> {
+            template <typename X>
+            static constexpr auto apply(X const& x) {
+                auto half = power_by_squaring<R, n / 2>::apply(x);
+                return hana::mult(half, half);
+            }
+        };
+
+        template <typename R, detail::std::size_t n>
+        struct power_by_squaring<R, n, true> {
+            template <typename X>
+            static constexpr auto apply(X const& x) {
+                auto half = power_by_squaring<R, n / 2>::apply(x);
+                return hana::mult(x, hana::mult(half, half));
+            }
+        };
+    }
+
     template <typename R, bool condition>
     struct power_impl<R, when<condition>> : default_ {
         template <typename X, typename N>
-        static constexpr decltype(auto) apply(X&& x, N&& n) {
-            using Exp = typename datatype<N>::type;
-            return eval_if(equal(n, zero<Exp>()),
-                always(one<R>()),
-                [&n, &x](auto _) -> decltype(auto) {
-                    return mult(
-                        x, apply(x, _(pred)(detail::std::forward<N>(n)))
-                    );
-                }
-            );
+        static constexpr auto apply_impl(X const& x, N const&, decltype(true_)) {
+            constexpr auto n = hana::value<N>();
+            return ring_detail::power_by_squaring<
+                R, static_cast<detail::std::size_t>(n)
+            >::apply(x);
+        }
+
+        // With an exponent known at runtime, the base is squared in a loop,
+        // which requires the multiplication to preserve the type of `x`.
+        template <typename X, typename N>
+        static constexpr auto apply_impl(X const& x, N const& n, decltype(false_)) {
+            auto result = hana::one<R>();
+            auto base = x;
+            for (N k = n; k != 0; k /= 2) {
+                if (k % 2 != 0)
+                    result = hana::mult(result, base);
+                if (k != 1)
+                    base = hana::mult(base, base);
+            }
+            return result;
+        }
+
+        template <typename X, typename N>
+        static constexpr auto apply(X const& x, N const& n) {
+            return apply_impl(x, n,
+                bool_<_models<Constant, typename datatype<N>::type>{}>);
         }
     };
 
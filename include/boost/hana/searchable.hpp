@@ -21,6 +21,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/forward.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/vectorize.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/id.hpp>
 #include <boost/hana/functional/partial.hpp>
@@ -181,13 +182,12 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <typename T, detail::std::size_t N>
     struct any_of_impl<T[N]> {
+        // For arithmetic elements, the remaining elements are searched in
+        // blocks that can be vectorized; see `detail::vectorize::any_of`.
         template <typename Xs, typename Pred>
         static constexpr bool any_of_helper(bool cond, Xs&& xs, Pred&& pred) {
             if (cond) return true;
-            for (detail::std::size_t i = 1; i < N; ++i)
-                if (pred(detail::std::forward<Xs>(xs)[i]))
-                    return true;
-            return false;
+            return detail::vectorize::any_of<T>(xs, 1, N, pred);
         }
 
         // Since an array contains homogeneous data, if the predicate returns
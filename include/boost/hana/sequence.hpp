@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/move.hpp>
 #include <boost/hana/detail/variadic/foldr.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
@@ -398,11 +399,10 @@ namespace boost { namespace hana {
         struct scanl1_helper {
             template <typename Xs, typename F>
             constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
-                //! @todo We need a way to extract the head of an Iterable
-                //! and get its tail at the same time. It would allow us to
-                //! use perfect forwarding here.
-                return hana::scanl(hana::tail(xs), hana::head(xs),
-                        detail::std::forward<F>(f));
+                auto ys = hana::uncons(detail::std::forward<Xs>(xs));
+                return hana::scanl(hana::second(detail::std::move(ys)),
+                                   hana::first(detail::std::move(ys)),
+                                   detail::std::forward<F>(f));
             }
         };
     }
@@ -0,0 +1,485 @@
+/*!
+@file
+Defines `boost::hana::serialize`, `boost::hana::deserialize` and
+`boost::hana::serialized_size`.
+
+@note
+This header includes `<cstring>`, `<stdexcept>` and `<vector>`. For this
+reason, it is not included by default by the master header of the library.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_SERIALIZATION_HPP
+#define BOOST_HANA_SERIALIZATION_HPP
+
+#include <boost/hana/fwd/serialization.hpp>
+
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_empty.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/is_trivially_copyable.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/ext/std/vector.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+
+namespace boost { namespace hana {
+    namespace serialization_detail {
+        // How an object is serialized:
+        // 0. Empty objects are not written at all.
+        // 1. The object representation of the object is written.
+        // 2. The object is serialized member by member.
+        // 3. The object is serialized with a specialization of
+        //    `serialize_impl`, or it can't be serialized.
+        template <typename X, typename T = typename datatype<X>::type>
+        using kind = detail::std::integral_constant<int,
+            detail::std::is_empty<X>{} ? 0 :
+            _models<Record, X>{} ? 2 :
+            detail::std::is_same<T, X>{} &&
+            detail::std::is_trivially_copyable<X>{} ? 1 :
+            3
+        >;
+
+        template <int k>
+        using kind_c = detail::std::integral_constant<int, k>;
+
+        template <typename X>
+        using is_bitwise = detail::std::integral_constant<bool,
+            kind<X>{} == 1
+        >;
+
+        template <typename X>
+        char const* bytes(X const& x)
+        { return &reinterpret_cast<char const&>(x); }
+
+        template <typename X>
+        char* bytes(X& x)
+        { return &reinterpret_cast<char&>(x); }
+
+        // Throws unless `count` objects of `size` bytes can be read from
+        // `[in, last)`. The division makes sure a huge `count` read from
+        // a malformed input does not overflow.
+        inline void check_input(char const* in, char const* last,
+                                unsigned long long count,
+                                detail::std::size_t size = 1)
+        {
+            if (count > static_cast<detail::std::size_t>(last - in) / size)
+                throw ::std::out_of_range{
+                    "hana::deserialize: the input is truncated"};
+        }
+
+        // A range of bytes which is copied with a single `memcpy`.
+        template <typename Ptr>
+        struct run {
+            Ptr first;
+            Ptr last;
+        };
+
+        // Writes the objects it is called with one after the other. Runs of
+        // objects whose representation is their object representation and
+        // which are adjacent in memory are written with a single `memcpy`.
+        // Since the address of a member is a constant offset from the
+        // address of its object, the adjacency tests are usually folded
+        // by the compiler.
+        struct writer {
+            char*& out;
+
+            template <typename X>
+            void write(run<char const*>&, X const&, kind_c<0>) const
+            { }
+
+            template <typename X>
+            void write(run<char const*>& r, X const& x, kind_c<1>) const {
+                char const* p = serialization_detail::bytes(x);
+                if (p != r.last) {
+                    flush(r);
+                    r.first = p;
+                }
+                r.last = p + sizeof(X);
+            }
+
+            template <typename X, int k>
+            void write(run<char const*>& r, X const& x, kind_c<k>) const {
+                flush(r);
+                out = hana::serialize(x, out);
+            }
+
+            void flush(run<char const*>& r) const {
+                if (r.first != r.last) {
+                    ::std::memcpy(out, r.first, r.last - r.first);
+                    out += r.last - r.first;
+                }
+                r.first = r.last;
+            }
+
+            template <typename ...X>
+            void operator()(X const& ...x) const {
+                run<char const*> r{nullptr, nullptr};
+                using swallow = int[];
+                (void)swallow{1, (write(r, x, kind<X>{}), void(), 1)...};
+                flush(r);
+            }
+        };
+
+        // Reads the objects it is called with one after the other, merging
+        // the `memcpy`s like `writer`. Every read is checked against the
+        // end of the input.
+        struct reader {
+            char const*& in;
+            char const* last;
+
+            template <typename X>
+            void read(run<char*>&, X&, kind_c<0>) const
+            { }
+
+            template <typename X>
+            void read(run<char*>& r, X& x, kind_c<1>) const {
+                char* p = serialization_detail::bytes(x);
+                if (p != r.last) {
+                    flush(r);
+                    r.first = p;
+                }
+                r.last = p + sizeof(X);
+            }
+
+            template <typename X, int k>
+            void read(run<char*>& r, X& x, kind_c<k>) const {
+                flush(r);
+                in = deserialize_impl<typename datatype<X>::type>::apply(in, last, x);
+            }
+
+            void flush(run<char*>& r) const {
+                if (r.first != r.last) {
+                    serialization_detail::check_input(in, last, r.last - r.first);
+                    ::std::memcpy(r.first, in, r.last - r.first);
+                    in += r.last - r.first;
+                }
+                r.first = r.last;
+            }
+
+            template <typename ...X>
+            void operator()(X& ...x) const {
+                run<char*> r{nullptr, nullptr};
+                using swallow = int[];
+                (void)swallow{1, (read(r, x, kind<X>{}), void(), 1)...};
+                flush(r);
+            }
+        };
+
+        struct sizer {
+            detail::std::size_t& size;
+
+            template <typename ...X>
+            void operator()(X const& ...x) const {
+                using swallow = int[];
+                (void)swallow{1, (size += hana::serialized_size(x), 1)...};
+            }
+        };
+
+        // Serialization of the objects whose representation is the
+        // concatenation of the representations of the objects they
+        // unpack to, i.e. `Record`s and `Tuple`s.
+        struct by_members {
+            template <typename X>
+            static detail::std::size_t size(X const& x) {
+                detail::std::size_t size = 0;
+                hana::unpack(x, sizer{size});
+                return size;
+            }
+
+            template <typename X>
+            static char* write(X const& x, char* out) {
+                hana::unpack(x, writer{out});
+                return out;
+            }
+
+            template <typename X>
+            static char const* read(char const* in, char const* last, X& x) {
+                hana::unpack(x, reader{in, last});
+                return in;
+            }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // serialize, serialized_size and deserialize
+    //////////////////////////////////////////////////////////////////////////
+    namespace serialization_detail {
+        template <typename X>
+        struct check_kind {
+            static_assert(kind<X>{} != 3,
+            "hana::serialize(x, out) requires x to be a Record, a Tuple, a "
+            "std::vector, an empty object or a trivially copyable object");
+        };
+    }
+
+    template <typename T, typename>
+    struct serialize_impl : serialize_impl<T, when<true>> { };
+
+    template <typename T, bool condition>
+    struct serialize_impl<T, when<condition>> : default_ {
+        template <typename X>
+        static char* helper(X const&, char* out, serialization_detail::kind_c<0>)
+        { return out; }
+
+        template <typename X>
+        static char* helper(X const& x, char* out, serialization_detail::kind_c<1>) {
+            ::std::memcpy(out, serialization_detail::bytes(x), sizeof(X));
+            return out + sizeof(X);
+        }
+
+        template <typename X>
+        static char* helper(X const& x, char* out, serialization_detail::kind_c<2>)
+        { return serialization_detail::by_members::write(x, out); }
+
+        template <typename X>
+        static char* apply(X const& x, char* out) {
+            (void)serialization_detail::check_kind<X>{};
+            return helper(x, out, serialization_detail::kind<X>{});
+        }
+    };
+
+    template <typename T, typename>
+    struct serialized_size_impl : serialized_size_impl<T, when<true>> { };
+
+    template <typename T, bool condition>
+    struct serialized_size_impl<T, when<condition>> : default_ {
+        template <typename X>
+        static constexpr detail::std::size_t
+        helper(X const&, serialization_detail::kind_c<0>)
+        { return 0; }
+
+        template <typename X>
+        static constexpr detail::std::size_t
+        helper(X const&, serialization_detail::kind_c<1>)
+        { return sizeof(X); }
+
+        template <typename X>
+        static detail::std::size_t
+        helper(X const& x, serialization_detail::kind_c<2>)
+        { return serialization_detail::by_members::size(x); }
+
+        template <typename X>
+        static constexpr detail::std::size_t apply(X const& x) {
+            (void)serialization_detail::check_kind<X>{};
+            return helper(x, serialization_detail::kind<X>{});
+        }
+    };
+
+    template <typename T, typename>
+    struct deserialize_impl : deserialize_impl<T, when<true>> { };
+
+    template <typename T, bool condition>
+    struct deserialize_impl<T, when<condition>> : default_ {
+        template <typename X>
+        static char const* helper(char const* in, char const*, X&, serialization_detail::kind_c<0>)
+        { return in; }
+
+        template <typename X>
+        static char const* helper(char const* in, char const* last, X& x, serialization_detail::kind_c<1>) {
+            serialization_detail::check_input(in, last, 1, sizeof(X));
+            ::std::memcpy(serialization_detail::bytes(x), in, sizeof(X));
+            return in + sizeof(X);
+        }
+
+        template <typename X>
+        static char const* helper(char const* in, char const* last, X& x, serialization_detail::kind_c<2>)
+        { return serialization_detail::by_members::read(in, last, x); }
+
+        template <typename X>
+        static char const* apply(char const* in, char const* last, X& x) {
+            (void)serialization_detail::check_kind<X>{};
+            return helper(in, last, x, serialization_detail::kind<X>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Tuple
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct serialize_impl<Tuple> {
+        template <typename Xs>
+        static char* apply(Xs const& xs, char* out)
+        { return serialization_detail::by_members::write(xs, out); }
+    };
+
+    template <>
+    struct serialized_size_impl<Tuple> {
+        template <typename Xs>
+        static detail::std::size_t apply(Xs const& xs)
+        { return serialization_detail::by_members::size(xs); }
+    };
+
+    template <>
+    struct deserialize_impl<Tuple> {
+        template <typename Xs>
+        static char const* apply(char const* in, char const* last, Xs& xs)
+        { return serialization_detail::by_members::read(in, last, xs); }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // std::vector
+    //////////////////////////////////////////////////////////////////////////
+    namespace serialization_detail {
+        // The elements of a `std::vector<T>` are contiguous, so they are
+        // copied with a single `memcpy` when the representation of `T` is
+        // its object representation. This is not the case for
+        // `std::vector<bool>`, which is handled separately.
+        template <typename T>
+        using vector_kind = detail::std::integral_constant<int,
+            detail::std::is_same<T, bool>{} ? 2 : is_bitwise<T>{} ? 1 : 0
+        >;
+
+        using vector_size = unsigned long long;
+    }
+
+    template <>
+    struct serialize_impl<ext::std::Vector> {
+        template <typename V>
+        static char* helper(V const& v, char* out, serialization_detail::kind_c<0>) {
+            for (auto const& x : v)
+                out = hana::serialize(x, out);
+            return out;
+        }
+
+        template <typename V>
+        static char* helper(V const& v, char* out, serialization_detail::kind_c<1>) {
+            detail::std::size_t bytes = v.size() * sizeof(typename V::value_type);
+            if (bytes != 0)
+                ::std::memcpy(out, v.data(), bytes);
+            return out + bytes;
+        }
+
+        template <typename V>
+        static char* helper(V const& v, char* out, serialization_detail::kind_c<2>) {
+            for (bool x : v)
+                *out++ = x;
+            return out;
+        }
+
+        template <typename V>
+        static char* apply(V const& v, char* out) {
+            serialization_detail::vector_size size = v.size();
+            ::std::memcpy(out, &size, sizeof(size));
+            return helper(v, out + sizeof(size),
+                serialization_detail::vector_kind<typename V::value_type>{});
+        }
+    };
+
+    template <>
+    struct serialized_size_impl<ext::std::Vector> {
+        template <typename V>
+        static detail::std::size_t helper(V const& v, serialization_detail::kind_c<0>) {
+            detail::std::size_t size = 0;
+            for (auto const& x : v)
+                size += hana::serialized_size(x);
+            return size;
+        }
+
+        template <typename V>
+        static detail::std::size_t helper(V const& v, serialization_detail::kind_c<1>)
+        { return v.size() * sizeof(typename V::value_type); }
+
+        template <typename V>
+        static detail::std::size_t helper(V const& v, serialization_detail::kind_c<2>)
+        { return v.size(); }
+
+        template <typename V>
+        static detail::std::size_t apply(V const& v) {
+            return sizeof(serialization_detail::vector_size) + helper(v,
+                serialization_detail::vector_kind<typename V::value_type>{});
+        }
+    };
+
+    template <>
+    struct deserialize_impl<ext::std::Vector> {
+        // The elements are appended as they are read, so a malformed size
+        // can't make us allocate much more memory than the input holds.
+        // This does not work when the representation of the elements is
+        // empty, since the input then holds any number of them. In that
+        // case, the vector is resized at once so that an absurd size fails
+        // right away with `std::length_error` or `std::bad_alloc`, instead
+        // of growing the vector until memory is exhausted.
+        template <typename V>
+        static char const* helper(char const* in, char const* last, V& v,
+                                  serialization_detail::vector_size size,
+                                  serialization_detail::kind_c<0>)
+        {
+            using T = typename datatype<typename V::value_type>::type;
+            detail::std::size_t left = last - in;
+            v.reserve(size < left ? size : left);
+            for (serialization_detail::vector_size i = 0; i < size; ++i) {
+                char const* first = in;
+                v.emplace_back();
+                in = deserialize_impl<T>::apply(in, last, v.back());
+                if (in == first && i == 0)
+                    return fill(in, last, v, size);
+            }
+            return in;
+        }
+
+        template <typename V>
+        static char const* fill(char const* in, char const* last, V& v,
+                                serialization_detail::vector_size size)
+        {
+            using T = typename datatype<typename V::value_type>::type;
+            if (size > v.max_size())
+                throw ::std::length_error{
+                    "hana::deserialize: the size of a std::vector is too large"};
+            v.resize(size);
+            for (detail::std::size_t i = 1; i < v.size(); ++i)
+                in = deserialize_impl<T>::apply(in, last, v[i]);
+            return in;
+        }
+
+        template <typename V>
+        static char const* helper(char const* in, char const* last, V& v,
+                                  serialization_detail::vector_size size,
+                                  serialization_detail::kind_c<1>)
+        {
+            serialization_detail::check_input(in, last, size,
+                                              sizeof(typename V::value_type));
+            v.resize(size);
+            detail::std::size_t bytes = v.size() * sizeof(typename V::value_type);
+            if (bytes != 0)
+                ::std::memcpy(v.data(), in, bytes);
+            return in + bytes;
+        }
+
+        template <typename V>
+        static char const* helper(char const* in, char const* last, V& v,
+                                  serialization_detail::vector_size size,
+                                  serialization_detail::kind_c<2>)
+        {
+            serialization_detail::check_input(in, last, size);
+            v.resize(size);
+            for (detail::std::size_t i = 0; i < v.size(); ++i)
+                v[i] = *in++ != 0;
+            return in;
+        }
+
+        template <typename V>
+        static char const* apply(char const* in, char const* last, V& v) {
+            serialization_detail::vector_size size;
+            serialization_detail::check_input(in, last, 1, sizeof(size));
+            ::std::memcpy(&size, in, sizeof(size));
+            v.clear();
+            return helper(in + sizeof(size), last, v, size,
+                serialization_detail::vector_kind<typename V::value_type>{});
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_SERIALIZATION_HPP
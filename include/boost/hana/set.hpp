@@ -18,13 +18,25 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/type_index.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/flip.hpp>
 #include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/monad_plus.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
 
@@ -34,7 +46,7 @@ namespace boost { namespace hana {
     // _set
     //////////////////////////////////////////////////////////////////////////
     template <typename ...Xs>
-    struct _set : operators::adl {
+    struct _set : operators::adl, detail::type_index<Xs...> {
         _tuple<Xs...> storage;
         using hana = _set;
         using datatype = Set;
@@ -117,16 +129,217 @@ namespace boost { namespace hana {
         }
     };
 
+    namespace set_detail {
+        // An element with exactly the type of the searched element is only
+        // known to be equal to it when that comparison is done at compile
+        // time; sets of runtime values like `set(1, 2)` must compare them.
+        template <typename X>
+        struct has_constant_equality
+            : _integral_constant<bool, _models<Constant,
+                typename datatype<decltype(hana::equal(
+                    detail::std::declval<X const&>(),
+                    detail::std::declval<X const&>()
+                ))>::type
+            >{}>
+        { };
+
+        // The index of the element of `S` with the same type as `X`, if
+        // it is known to be equal to `X`. Otherwise, `true_` if `X` is
+        // known not to be in `S`, and `false_` if we have to search `S`.
+        template <typename S, typename X,
+                  typename Found = detail::index_of_type<S, X>>
+        struct lookup
+            : detail::std::conditional<has_constant_equality<X>{},
+                Found, decltype(false_)
+            >
+        { };
+
+        template <typename S, typename X>
+        struct lookup<S, X, void> {
+            using type = decltype(bool_<detail::has_identity_equality<X>{}>);
+        };
+
+        template <typename S, typename X>
+        using lookup_t = typename lookup<
+            S, typename detail::std::decay<X>::type
+        >::type;
+    }
+
+    template <>
+    struct find_impl<Set> {
+        template <typename S, typename X, detail::std::size_t i>
+        static constexpr auto
+        helper(S&& set, X&&,
+               detail::std::integral_constant<detail::std::size_t, i>) {
+            return hana::just(detail::get<i>(
+                                detail::std::forward<S>(set).storage));
+        }
+
+        template <typename S, typename X>
+        static constexpr auto helper(S&&, X&&, decltype(true_))
+        { return nothing; }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto)
+        helper(S&& set, X&& x, decltype(false_)) {
+            return hana::find_if(detail::std::forward<S>(set),
+                    hana::equal.to(detail::std::forward<X>(x)));
+        }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto) apply(S&& set, X&& x) {
+            return helper(detail::std::forward<S>(set),
+                          detail::std::forward<X>(x),
+                          set_detail::lookup_t<S, X>{});
+        }
+    };
+
+    template <>
+    struct elem_impl<Set> {
+        template <typename S, typename X, detail::std::size_t i>
+        static constexpr auto
+        helper(S&&, X&&,
+               detail::std::integral_constant<detail::std::size_t, i>)
+        { return true_; }
+
+        template <typename S, typename X>
+        static constexpr auto helper(S&&, X&&, decltype(true_))
+        { return false_; }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto)
+        helper(S&& set, X&& x, decltype(false_)) {
+            return hana::any_of(detail::std::forward<S>(set),
+                    hana::equal.to(detail::std::forward<X>(x)));
+        }
+
+        template <typename S, typename X>
+        static constexpr decltype(auto) apply(S&& set, X&& x) {
+            return helper(detail::std::forward<S>(set),
+                          detail::std::forward<X>(x),
+                          set_detail::lookup_t<S, X>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Conversions
     //////////////////////////////////////////////////////////////////////////
+    namespace set_detail {
+        template <typename X>
+        struct key { };
+
+        struct root { static void at(); };
+
+        // Each occurrence hides the previous occurrences of an element with
+        // the same type, so `Chain::at((key<X>*)nullptr)` is the index of
+        // the last element of type `X`.
+        template <detail::std::size_t i, typename X, typename Previous>
+        struct occurrence : Previous {
+            using Previous::at;
+            static constexpr detail::std::size_t at(key<X>*) { return i; }
+        };
+
+        template <typename Chain, detail::std::size_t i, typename ...X>
+        struct make_chain { using type = Chain; };
+
+        template <typename Chain, detail::std::size_t i,
+                  typename X, typename ...Xs>
+        struct make_chain<Chain, i, X, Xs...>
+            : make_chain<occurrence<i, X, Chain>, i + 1, Xs...>
+        { };
+
+        // Eight elements are added at a time, and the chain is completed
+        // right away. Otherwise, completing the chain would require as many
+        // nested instantiations as there are elements, which quickly exceeds
+        // the maximum template instantiation depth.
+        template <typename Chain, detail::std::size_t i,
+                  typename X0, typename X1, typename X2, typename X3,
+                  typename X4, typename X5, typename X6, typename X7,
+                  typename ...Xs>
+        struct make_chain<Chain, i, X0, X1, X2, X3, X4, X5, X6, X7, Xs...> {
+            using Next =
+                occurrence<i + 7, X7, occurrence<i + 6, X6,
+                occurrence<i + 5, X5, occurrence<i + 4, X4,
+                occurrence<i + 3, X3, occurrence<i + 2, X2,
+                occurrence<i + 1, X1, occurrence<i + 0, X0, Chain
+            >>>>>>>>;
+            static_assert(sizeof(Next) > 0, "");
+
+            using type = typename make_chain<Next, i + 8, Xs...>::type;
+        };
+
+        // Whether each element is the last one with its type. This can be
+        // used with `tuple_detail::where` to get the indices of the elements
+        // of a set built from elements that are equal iff they have the
+        // same type.
+        template <typename Indices, typename ...X>
+        struct last_occurrences;
+
+        template <detail::std::size_t ...i, typename ...X>
+        struct last_occurrences<detail::std::index_sequence<i...>, X...> {
+            using Chain = typename make_chain<root, 0, X...>::type;
+
+            static constexpr detail::array<bool, sizeof...(X)> values()
+            { return {{Chain::at((key<X>*)nullptr) == i...}}; }
+
+            static constexpr detail::std::size_t count(bool which) {
+                constexpr detail::array<bool, sizeof...(X)> results = values();
+                detail::std::size_t n = 0;
+                for (bool result : results)
+                    n += result == which;
+                return n;
+            }
+        };
+
+        template <typename Xs>
+        struct elements;
+
+        template <typename ...X>
+        struct elements<_tuple<X...>> {
+            static constexpr bool have_identity_equality() {
+                bool identity[] = {true, detail::has_identity_equality<X>{}...};
+                return tuple_detail::all(identity);
+            }
+
+            using unique = tuple_detail::where<last_occurrences<
+                detail::std::make_index_sequence<sizeof...(X)>, X...
+            >, true>;
+        };
+
+        template <typename Xs>
+        using elements_of = elements<typename detail::std::decay<
+            decltype(hana::to<Tuple>(detail::std::declval<Xs>()))
+        >::type>;
+
+        template <typename Xs, detail::std::size_t ...i>
+        constexpr auto gather(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Set>(detail::get<i>(
+                                    detail::std::forward<Xs>(xs))...);
+        }
+    }
+
     template <typename F>
     struct to_impl<Set, F, when<_models<Foldable, F>{}>> {
         template <typename Xs>
-        static constexpr decltype(auto) apply(Xs&& xs) {
+        static constexpr decltype(auto) helper(Xs&& xs, decltype(false_)) {
             return hana::foldr(detail::std::forward<Xs>(xs),
                                 set(), hana::flip(insert));
         }
+
+        template <typename Xs>
+        static constexpr auto helper(Xs&& xs, decltype(true_)) {
+            return set_detail::gather(
+                hana::to<Tuple>(detail::std::forward<Xs>(xs)),
+                typename set_detail::elements_of<Xs>::unique{}
+            );
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            using Elements = set_detail::elements_of<Xs>;
+            return helper(detail::std::forward<Xs>(xs),
+                          bool_<Elements::have_identity_equality()>);
+        }
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -152,6 +365,58 @@ namespace boost { namespace hana {
             );
         }
     };
+
+    //////////////////////////////////////////////////////////////////////////
+    // union_, intersection and difference
+    //////////////////////////////////////////////////////////////////////////
+    namespace set_detail {
+        template <typename S>
+        struct in {
+            S const& set;
+
+            template <typename X>
+            constexpr auto operator()(X const& x) const
+            { return hana::elem(set, x); }
+        };
+
+        template <typename S>
+        struct not_in {
+            S const& set;
+
+            template <typename X>
+            constexpr auto operator()(X const& x) const
+            { return hana::not_(hana::elem(set, x)); }
+        };
+    }
+
+    //! @cond
+    template <typename S1, typename S2>
+    constexpr auto _union::operator()(S1&& s1, S2&& s2) const {
+        return hana::unpack(hana::concat(
+            detail::std::forward<S1>(s1).storage,
+            hana::filter(detail::std::forward<S2>(s2).storage,
+                         set_detail::not_in<S1>{s1})
+        ), hana::set);
+    }
+
+    template <typename S1, typename S2>
+    constexpr auto _intersection::operator()(S1&& s1, S2&& s2) const {
+        return hana::unpack(
+            hana::filter(detail::std::forward<S1>(s1).storage,
+                         set_detail::in<S2>{s2}),
+            hana::set
+        );
+    }
+
+    template <typename S1, typename S2>
+    constexpr auto _difference::operator()(S1&& s1, S2&& s2) const {
+        return hana::unpack(
+            hana::filter(detail::std::forward<S1>(s1).storage,
+                         set_detail::not_in<S2>{s2}),
+            hana::set
+        );
+    }
+    //! @endcond
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_SET_HPP
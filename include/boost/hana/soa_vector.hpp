@@ -0,0 +1,295 @@
+/*!
+@file
+Defines `boost::hana::soa_vector`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_SOA_VECTOR_HPP
+#define BOOST_HANA_SOA_VECTOR_HPP
+
+#include <boost/hana/fwd/soa_vector.hpp>
+
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/type_index.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/product.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <vector>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // soa_vector
+    //////////////////////////////////////////////////////////////////////////
+    namespace soa_vector_detail {
+        template <typename Member>
+        using name_of = typename detail::std::decay<decltype(
+            hana::first(detail::std::declval<Member>())
+        )>::type;
+
+        template <typename R, typename Member>
+        using column_of = ::std::vector<typename detail::std::decay<decltype(
+            hana::second(detail::std::declval<Member>())(
+                detail::std::declval<R&>()
+            )
+        )>::type>;
+
+        template <typename R, typename ...Member>
+        struct layout_of {
+            static constexpr detail::std::size_t size = sizeof...(Member);
+            using names = detail::type_index<name_of<Member>...>;
+            using columns = _tuple<column_of<R, Member>...>;
+        };
+
+        template <typename R>
+        struct make_layout {
+            template <typename ...Member>
+            constexpr auto operator()(Member&& ...) const {
+                return layout_of<R,
+                    typename detail::std::decay<Member>::type...
+                >{};
+            }
+        };
+
+        // The names and the buffers of the members of `R`, in the order of
+        // `members<R>()`.
+        template <typename R>
+        using layout = decltype(
+            hana::unpack(hana::members<R>(), make_layout<R>{})
+        );
+
+        // Member names are looked up by type, so only names whose type
+        // identifies them can be used with `operator[]`.
+        template <typename Name>
+        using enable_if_name = detail::std::enable_if_t<
+            detail::has_identity_equality<Name>{}
+        >;
+
+        template <typename Vec>
+        struct reference;
+
+        template <detail::std::size_t i>
+        struct column;
+    }
+
+    // We inherit from the `type_index` of the member names so that a buffer
+    // can be found by name with a single overload resolution.
+    template <typename R>
+    struct soa_vector : soa_vector_detail::layout<R>::names {
+        using value_type = R;
+        using size_type = detail::std::size_t;
+        using reference = soa_vector_detail::reference<soa_vector>;
+        using const_reference = soa_vector_detail::reference<soa_vector const>;
+
+        static_assert(soa_vector_detail::layout<R>::size > 0,
+        "hana::soa_vector<R> requires R to have at least one member");
+
+        soa_vector() = default;
+
+        size_type size() const
+        { return hana::head(columns_).size(); }
+
+        bool empty() const
+        { return size() == 0; }
+
+        void reserve(size_type n)
+        { hana::for_each(columns_, [n](auto& column) { column.reserve(n); }); }
+
+        void clear()
+        { hana::for_each(columns_, [](auto& column) { column.clear(); }); }
+
+        void push_back(R const& r)
+        { push_back_helper(r, indices{}); }
+
+        void push_back(R&& r)
+        { push_back_helper(detail::std::move(r), indices{}); }
+
+        reference operator[](size_type n)
+        { return reference{this, n}; }
+
+        const_reference operator[](size_type n) const
+        { return const_reference{this, n}; }
+
+        template <typename Name,
+                  typename = soa_vector_detail::enable_if_name<Name>>
+        auto& operator[](Name const&)
+        { return hana::at_c<index_of<Name>()>(columns_); }
+
+        template <typename Name,
+                  typename = soa_vector_detail::enable_if_name<Name>>
+        auto const& operator[](Name const&) const
+        { return hana::at_c<index_of<Name>()>(columns_); }
+
+    private:
+        template <typename>
+        friend struct soa_vector_detail::reference;
+
+        template <detail::std::size_t>
+        friend struct soa_vector_detail::column;
+
+        using indices = detail::std::make_index_sequence<
+            soa_vector_detail::layout<R>::size
+        >;
+
+        template <typename Name>
+        static constexpr size_type index_of() {
+            using Index = detail::index_of_type<soa_vector, Name>;
+            static_assert(!detail::std::is_same<Index, void>{},
+            "hana::soa_vector<R>: R has no member with the given name");
+            return detail::std::conditional<
+                detail::std::is_same<Index, void>{},
+                detail::std::integral_constant<size_type, 0>, Index
+            >::type::value;
+        }
+
+        // As for the Foldable model of Records, the accessors may move
+        // from `udt` because each of them only accesses its own member.
+        //
+        // The capacity of all the columns is grown first, so that a
+        // `std::bad_alloc` leaves all the columns unchanged. Then, if
+        // copying or moving a member throws, the members already pushed
+        // to the previous columns are popped, so that all the columns
+        // keep the same size.
+        template <typename Udt, size_type ...i>
+        void push_back_helper(Udt&& udt, detail::std::index_sequence<i...>) {
+            size_type const n = size();
+            hana::for_each(columns_, [n](auto& column) {
+                if (column.capacity() == n)
+                    column.reserve(n == 0 ? 1 : 2 * n);
+            });
+
+            auto members = hana::members<R>();
+            size_type pushed = 0;
+            using swallow = int[];
+            try {
+                (void)swallow{1,
+                    (hana::at_c<i>(columns_).push_back(
+                        hana::second(hana::at_c<i>(members))(
+                            detail::std::forward<Udt>(udt)
+                        )
+                    ), ++pushed, void(), 1)...
+                };
+            }
+            catch (...) {
+                (void)swallow{1,
+                    (i < pushed ? hana::at_c<i>(columns_).pop_back()
+                                : void(), void(), 1)...
+                };
+                throw;
+            }
+        }
+
+        template <typename Udt, size_type ...i>
+        void store(size_type n, Udt&& udt, detail::std::index_sequence<i...>) {
+            auto members = hana::members<R>();
+            using swallow = int[];
+            (void)swallow{1,
+                (hana::at_c<i>(columns_)[n] =
+                    hana::second(hana::at_c<i>(members))(
+                        detail::std::forward<Udt>(udt)
+                    ),
+                void(), 1)...
+            };
+        }
+
+        template <size_type ...i>
+        R load(size_type n, detail::std::index_sequence<i...>) const {
+            auto members = hana::members<R>();
+            R r{};
+            using swallow = int[];
+            (void)swallow{1,
+                (hana::second(hana::at_c<i>(members))(r) =
+                    hana::at_c<i>(columns_)[n],
+                void(), 1)...
+            };
+            return r;
+        }
+
+        typename soa_vector_detail::layout<R>::columns columns_;
+    };
+
+    namespace soa_vector_detail {
+        // Proxy to the `n`-th element of a `soa_vector`. `Vec` is
+        // `soa_vector<R>` or `soa_vector<R> const`.
+        template <typename Vec>
+        struct reference {
+            using value_type = typename detail::std::remove_cv<Vec>::type::value_type;
+
+            Vec* vec_;
+            detail::std::size_t n_;
+
+            template <typename Name, typename = enable_if_name<Name>>
+            decltype(auto) operator[](Name const& name) const
+            { return (*vec_)[name][n_]; }
+
+            operator value_type() const
+            { return vec_->load(n_, typename Vec::indices{}); }
+
+            reference const& operator=(value_type const& r) const {
+                vec_->store(n_, r, typename Vec::indices{});
+                return *this;
+            }
+
+            reference const& operator=(value_type&& r) const {
+                vec_->store(n_, detail::std::move(r), typename Vec::indices{});
+                return *this;
+            }
+
+            // Assigning a proxy to another assigns the referred-to elements
+            // instead of rebinding the proxy, like for a reference.
+            reference const& operator=(reference const& other) const
+            { return *this = static_cast<value_type>(other); }
+        };
+
+        template <detail::std::size_t i>
+        struct column {
+            template <typename Vec>
+            constexpr decltype(auto) operator()(Vec&& vec) const {
+                return hana::at_c<i>(
+                    detail::std::forward<Vec>(vec).columns_
+                );
+            }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Record
+    //////////////////////////////////////////////////////////////////////////
+    template <typename R>
+    struct members_impl<soa_vector<R>> {
+        template <typename Members, detail::std::size_t ...i>
+        static constexpr auto
+        helper(Members const& members, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(
+                hana::pair(hana::first(hana::at_c<i>(members)),
+                           soa_vector_detail::column<i>{})...
+            );
+        }
+
+        static constexpr auto apply() {
+            return helper(hana::members<R>(),
+                detail::std::make_index_sequence<
+                    soa_vector_detail::layout<R>::size
+                >{});
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_SOA_VECTOR_HPP
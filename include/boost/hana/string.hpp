@@ -97,13 +97,14 @@ namespace boost { namespace hana {
     // Orderable
     //////////////////////////////////////////////////////////////////////////
     template <>
-    struct less_impl<String, String> {
-        static constexpr bool less_helper(char const* s1, char const* s2) {
+    struct compare_impl<String, String> {
+        static constexpr int compare_helper(char const* s1, char const* s2) {
             while (*s1 != '\0' && *s2 != '\0' && *s1 == *s2)
                 ++s1, ++s2;
 
-            return (*s1 == '\0' && *s2 != '\0') || // s1 is shorter than s2
-                   (*s1 != '\0' && *s2 != '\0' && *s1 < *s2); // s1[0] < s2[0]
+                 if (*s1 == '\0') return *s2 == '\0' ? 0 : -1; // s1 is a prefix of s2
+            else if (*s2 == '\0') return 1;                   // s2 is a prefix of s1
+            else                 return *s1 < *s2 ? -1 : 1;
         }
 
         template <char ...s1, char ...s2>
@@ -111,10 +112,15 @@ namespace boost { namespace hana {
         apply(_string<s1...> const&, _string<s2...> const&) {
             constexpr char const c_str1[] = {s1..., '\0'};
             constexpr char const c_str2[] = {s2..., '\0'};
-            return bool_<less_helper(c_str1, c_str2)>;
+            return int_<compare_helper(c_str1, c_str2)>;
         }
     };
 
+    template <>
+    struct less_impl<String, String>
+        : Orderable::less_impl<String, String>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,126 @@
+/*!
+@file
+Defines the model of `Comparable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_COMPARABLE_HPP
+#define BOOST_HANA_TUPLE_COMPARABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/detail/dependent_on.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/has_unique_bytes.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple/iterable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    namespace tuple_detail {
+        // How two tuples are compared:
+        // 0. With the generic `Sequence::equal_impl`, since the result may
+        //    be a `Constant`.
+        // 1. With `equal_elements<false>`, when the tuples are not empty,
+        //    have the same length and comparing their elements only gives
+        //    runtime `bool`s.
+        // 2. With `equal_elements<true>`, when additionally the tuples have
+        //    the same type and their elements are integers covering all
+        //    their bytes.
+        template <typename Xs, typename Ys, typename = void>
+        struct equal_kind : detail::std::integral_constant<int, 0> { };
+
+        template <typename ...X, typename ...Y>
+        struct equal_kind<_tuple<X...>, _tuple<Y...>, detail::std::enable_if_t<
+            sizeof...(X) == sizeof...(Y) && sizeof...(X) != 0
+        >>
+            : detail::std::integral_constant<int,
+                !detail::fast_and<detail::std::is_same<decltype(hana::equal(
+                    detail::std::declval<X const&>(),
+                    detail::std::declval<Y const&>()
+                )), bool>::value...>{} ? 0 :
+                detail::std::is_same<_tuple<X...>, _tuple<Y...>>{} &&
+                detail::has_unique_bytes<_tuple<X...>>{} ? 2 :
+                1
+            >
+        { };
+
+        // Compares the elements in a single expression; see the equality
+        // of `Record`s.
+        template <bool bitwise, typename Xs, typename Ys,
+                  detail::std::size_t ...i>
+        constexpr bool equal_elements(Xs const& xs, Ys const& ys,
+                                      detail::std::index_sequence<i...>)
+        {
+            bool result = true;
+            using swallow = bool[];
+            (void)swallow{true, (result = bitwise
+                ? result & hana::equal(detail::get<i>(xs), detail::get<i>(ys))
+                : result && hana::equal(detail::get<i>(xs), detail::get<i>(ys))
+            )...};
+            return result;
+        }
+    }
+
+    template <>
+    struct equal_impl<Tuple, Tuple> {
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto)
+        helper(Xs const& xs, Ys const& ys, detail::std::integral_constant<int, 0>) {
+            using Tpl = detail::dependent_on_t<sizeof(xs) == 1, Tuple>;
+            return Sequence::equal_impl<Tpl, Tpl>::apply(xs, ys);
+        }
+
+        template <typename Xs, typename Ys, int kind>
+        static constexpr bool
+        helper(Xs const& xs, Ys const& ys, detail::std::integral_constant<int, kind>) {
+            return tuple_detail::equal_elements<kind == 2>(xs, ys,
+                detail::std::make_index_sequence<tuple_detail::size<Xs>{}>{});
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs const& xs, Ys const& ys)
+        { return helper(xs, ys, tuple_detail::equal_kind<Xs, Ys>{}); }
+
+
+        // tuple_t optimizations
+        template <typename ...T>
+        static constexpr auto apply(_tuple_t<T...>, _tuple_t<T...>)
+        { return true_; }
+
+        template <typename ...T, typename ...U>
+        static constexpr auto apply(_tuple_t<T...>, _tuple_t<U...>)
+        { return false_; }
+
+
+        // tuple_c optimizations
+        template <typename V, V ...v, typename U, U ...u, typename =
+            detail::std::enable_if_t<sizeof...(v) == sizeof...(u)>>
+        static constexpr auto apply(_tuple_c<V, v...>, _tuple_c<U, u...>) {
+            constexpr bool comparisons[] = {true, (v == u)...};
+            return bool_<hana::all(comparisons)>;
+        }
+
+        template <typename V, V ...v, typename U, U ...u, typename =
+            detail::std::enable_if_t<sizeof...(v) != sizeof...(u)>>
+        static constexpr auto apply(_tuple_c<V, v...>, _tuple_c<U, u...>, ...)
+        { return false_; }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_COMPARABLE_HPP
@@ -0,0 +1,258 @@
+/*!
+@file
+Defines the `boost::hana::Tuple` container, with `make`, `at` and `unpack`.
+
+This header declares the models of `Foldable` and `Iterable` required by
+`unpack` and `at`, together with their minimal complete definitions. The
+other methods of these concepts and the models of the other concepts are
+defined in the other headers of `boost/hana/tuple/`, or all at once by
+`boost/hana/tuple.hpp`. Since those headers specialize the methods they
+define for `Tuple`, they must be included before the methods are used.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_CORE_HPP
+#define BOOST_HANA_TUPLE_CORE_HPP
+
+#include <boost/hana/fwd/tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/for_each_ref.hpp>
+#include <boost/hana/detail/has_unique_bytes.hpp>
+#include <boost/hana/detail/iterable_ops.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/fwd/comparable.hpp>
+#include <boost/hana/fwd/foldable.hpp>
+#include <boost/hana/fwd/group.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
+#include <boost/hana/fwd/iterable.hpp>
+#include <boost/hana/fwd/monad.hpp>
+#include <boost/hana/fwd/monoid.hpp>
+#include <boost/hana/fwd/orderable.hpp>
+#include <boost/hana/fwd/ring.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // tuple, tuple_t and tuple_c
+    //////////////////////////////////////////////////////////////////////////
+    // Note that we do not inherit from `operators::adl`, since
+    // `operators::Iterable_ops` already makes the operators visible to
+    // ADL. Inheriting from it would prevent empty elements which also
+    // derive from `operators::adl` from being laid out at offset 0.
+    template <typename ...Xs>
+    struct _tuple
+        : detail::closure<Xs...>
+        , operators::Iterable_ops<_tuple<Xs...>>
+    {
+        using detail::closure<Xs...>::closure; // inherit constructor
+
+        // Empty elements are stored as (private) base classes of the closure,
+        // so we make sure their `operator[]`, if any, does not clash with ours.
+        using operators::Iterable_ops<_tuple<Xs...>>::operator[];
+
+        _tuple() = default;
+        _tuple(_tuple&&) = default;
+        _tuple(_tuple const&) = default;
+        _tuple(_tuple&) = default;
+
+        using hana = _tuple;
+        using datatype = Tuple;
+
+        static constexpr detail::std::size_t size = sizeof...(Xs);
+        static constexpr bool is_empty = sizeof...(Xs) == 0;
+    };
+
+    template <typename T, T ...v>
+    struct _tuple_c : _tuple<_integral_constant<T, v>...> { };
+
+    // The elements of `tuple_t` are `Type`s, so `boost/hana/type.hpp` must
+    // also be included to use it.
+    template <typename ...T>
+    struct _tuple_t {
+        struct _;
+    };
+
+    template <typename ...T>
+    struct _tuple_t<T...>::_
+        : _tuple_t<T...>,
+          _tuple<typename detail::std::remove_cv<decltype(type<T>)>::type...>
+    { };
+
+    namespace detail {
+        template <typename ...Xs>
+        struct has_unique_bytes<_tuple<Xs...>, Tuple>
+            : detail::std::integral_constant<bool,
+                detail::packed<_tuple<Xs...>, Xs...>()
+            >
+        { };
+    }
+
+    template <>
+    struct operators::of<Tuple>
+        : operators::of<Comparable, Orderable, Monoid, Group, Ring, Monad, Iterable>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<Tuple> {
+        template <typename ...Xs>
+        static constexpr
+        _tuple<typename detail::std::decay<Xs>::type...> apply(Xs&& ...xs)
+        { return {detail::std::forward<Xs>(xs)...}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace tuple_detail {
+        template <typename Xs>
+        using size = _integral_constant<detail::std::size_t,
+            detail::std::remove_reference<Xs>::type::size
+        >;
+
+        template <bool, typename T>
+        using expand = T;
+
+        template <typename Xs, detail::std::size_t ...i>
+        constexpr decltype(auto)
+        gather(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(detail::get<i>(
+                                        detail::std::forward<Xs>(xs))...);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // unpack
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct models_impl<Foldable, Tuple>
+        : decltype(true_)
+    { };
+
+    template <>
+    struct unpack_impl<Tuple> {
+        #define BOOST_HANA_PP_UNPACK(REF)                                   \
+            template <typename ...Xs, typename F>                           \
+            static constexpr decltype(auto)                                 \
+            apply(detail::closure_impl<Xs...> REF xs, F&& f) {              \
+                return detail::std::forward<F>(f)(                          \
+                    static_cast<Xs REF>(xs).get()...                        \
+                );                                                          \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_UNPACK)
+        #undef BOOST_HANA_PP_UNPACK
+
+        template <typename ...T, template <typename ...> class F>
+        static constexpr auto apply(_tuple_t<T...>, _metafunction<F>)
+        { return type<typename F<T...>::type>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // head, tail, is_empty, at and visit_at
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct models_impl<Iterable, Tuple>
+        : decltype(true_)
+    { };
+
+    template <>
+    struct head_impl<Tuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return detail::get<0>(detail::std::forward<Xs>(xs)); }
+    };
+
+    template <>
+    struct tail_impl<Tuple> {
+        #define BOOST_HANA_PP_TAIL(REF)                                     \
+            template <typename X, typename ...Xn>                           \
+            static constexpr _tuple<typename Xn::get_type...>               \
+            apply(detail::closure_impl<X, Xn...> REF xs) {                  \
+                return {static_cast<Xn REF>(xs).get()...};                  \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_TAIL)
+        #undef BOOST_HANA_PP_TAIL
+    };
+
+    template <>
+    struct is_empty_impl<Tuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return bool_<Xs::is_empty>; }
+    };
+
+    template <>
+    struct at_impl<Tuple> {
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr detail::std::size_t index = hana::value<N>();
+            return detail::get<index>(detail::std::forward<Xs>(xs));
+        }
+    };
+
+    namespace tuple_detail {
+        template <detail::std::size_t i, typename Xs, typename F>
+        void visit(Xs&& xs, F& f)
+        { f(detail::get<i>(detail::std::forward<Xs>(xs))); }
+
+        template <typename Xs, typename F, typename Indices>
+        struct visit_table;
+
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        struct visit_table<Xs, F, detail::std::index_sequence<i...>> {
+            static constexpr void (*table[])(Xs&&, F&) = {&visit<i, Xs, F>...};
+
+            static bool apply(detail::std::size_t n, Xs&& xs, F& f) {
+                if (n >= sizeof...(i))
+                    return false;
+                table[n](detail::std::forward<Xs>(xs), f);
+                return true;
+            }
+        };
+
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        constexpr void (*visit_table<
+            Xs, F, detail::std::index_sequence<i...>
+        >::table[])(Xs&&, F&);
+
+        template <typename Xs, typename F>
+        struct visit_table<Xs, F, detail::std::index_sequence<>> {
+            static bool apply(detail::std::size_t, Xs&&, F&)
+            { return false; }
+        };
+    }
+
+    template <>
+    struct visit_at_impl<Tuple> {
+        template <typename Xs, typename F>
+        static bool apply(detail::std::size_t n, Xs&& xs, F&& f) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            return tuple_detail::visit_table<
+                Xs, typename detail::std::remove_reference<F>::type,
+                detail::std::make_index_sequence<size>
+            >::apply(n, detail::std::forward<Xs>(xs), f);
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_CORE_HPP
@@ -0,0 +1,61 @@
+/*!
+@file
+Defines the model of `Foldable` for `boost::hana::Tuple`.
+
+The method `unpack` is defined in `boost/hana/tuple/core.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_FOLDABLE_HPP
+#define BOOST_HANA_TUPLE_FOLDABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/detail/dependent_on.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/tuple_predicates.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct length_impl<Tuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<Xs::size>; }
+    };
+
+    template <>
+    struct count_if_impl<Tuple> {
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr auto helper(decltype(true_), Xs&&, Pred&&)
+        { return size_t<Results::count(true)>; }
+
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            using Tpl = detail::dependent_on_t<sizeof(xs) == 1, Tuple>;
+            return count_if_impl<Tpl, when<true>>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            using Results = tuple_detail::results_of<Xs, Pred>;
+            return helper<Results>(bool_<Results::is_constant()>,
+                                   detail::std::forward<Xs>(xs),
+                                   detail::std::forward<Pred>(pred));
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_FOLDABLE_HPP
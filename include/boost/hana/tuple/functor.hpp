@@ -0,0 +1,93 @@
+/*!
+@file
+Defines the model of `Functor` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_FUNCTOR_HPP
+#define BOOST_HANA_TUPLE_FUNCTOR_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/detail/for_each_ref.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/type.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<Tuple> {
+        #define BOOST_HANA_PP_TRANSFORM(REF)                                \
+            template <typename ...Xs, typename F>                           \
+            static constexpr decltype(auto)                                 \
+            apply_fun(detail::closure_impl<Xs...> REF xs, F&& f)            \
+            {                                                               \
+                return hana::make<Tuple>(                                   \
+                    f(static_cast<Xs REF>(xs).get())...                     \
+                );                                                          \
+            }                                                               \
+                                                                            \
+            template <typename X, typename F>                               \
+            static constexpr decltype(auto)                                 \
+            apply_fun(detail::closure_impl<X> REF xs, F&& f) {              \
+                return hana::make<Tuple>(detail::std::forward<F>(f)(        \
+                    static_cast<X REF>(xs).get()                            \
+                ));                                                         \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_TRANSFORM)
+        #undef BOOST_HANA_PP_TRANSFORM
+
+        template <typename ...T, template <typename ...> class F>
+        static constexpr auto
+        apply_metafun(_tuple_t<T...> const&, _metafunction<F> const&)
+        { return tuple_t<typename F<T>::type...>; }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply_dispatch(Xs&& xs, F&& f, int)
+            -> decltype(apply_metafun(xs, f))
+        { return apply_metafun(xs, f); }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply_dispatch(Xs&& xs, F&& f, long) {
+            return apply_fun(detail::std::forward<Xs>(xs),
+                             detail::std::forward<F>(f));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return apply_dispatch(detail::std::forward<Xs>(xs),
+                                  detail::std::forward<F>(f), int{});
+        }
+    };
+
+    template <>
+    struct fill_impl<Tuple> {
+        template <typename V>
+        static constexpr _tuple<> apply(detail::closure_impl<> const&, V&&)
+        { return {}; }
+
+        template <typename X, typename ...Xs, typename V>
+        static constexpr _tuple<
+            typename detail::std::decay<V>::type,
+            typename detail::std::decay<
+                tuple_detail::expand<!!sizeof(Xs), V>
+            >::type...
+        > apply(detail::closure_impl<X, Xs...> const&, V&& v)
+        { return {((void)sizeof(Xs), v)..., detail::std::forward<V>(v)}; }
+
+        template <typename ...Xs, typename T>
+        static constexpr auto apply(_tuple<Xs...> const&, _type<T> const&)
+        { return tuple_t<tuple_detail::expand<!!sizeof(Xs), T>...>; }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_FUNCTOR_HPP
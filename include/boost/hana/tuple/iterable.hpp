@@ -0,0 +1,61 @@
+/*!
+@file
+Defines the model of `Iterable` for `boost::hana::Tuple`.
+
+The minimal complete definition (`head`, `tail` and `is_empty`), `at` and
+`visit_at` are defined in `boost/hana/tuple/core.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_ITERABLE_HPP
+#define BOOST_HANA_TUPLE_ITERABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/tuple/foldable.hpp>
+#include <boost/hana/tuple/searchable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct last_impl<Tuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            return detail::get<size - 1>(detail::std::forward<Xs>(xs));
+        }
+    };
+
+    template <>
+    struct drop_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <Size n, typename Xs, Size ...i>
+        static constexpr decltype(auto)
+        drop_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(
+                        detail::get<n + i>(detail::std::forward<Xs>(xs))...);
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr Size n = hana::value<N>();
+            constexpr Size size = tuple_detail::size<Xs>{};
+            constexpr Size drop_size = n > size ? size : n;
+            return drop_helper<drop_size>(detail::std::forward<Xs>(xs),
+                detail::std::make_index_sequence<size - drop_size>{});
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_ITERABLE_HPP
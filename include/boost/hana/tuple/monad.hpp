@@ -0,0 +1,106 @@
+/*!
+@file
+Defines the models of `Applicative` and `Monad` for `boost::hana::Tuple`.
+
+The method `ap` is provided by the model of `Sequence`, in
+`boost/hana/tuple/sequence.hpp`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_MONAD_HPP
+#define BOOST_HANA_TUPLE_MONAD_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/applicative.hpp>
+#include <boost/hana/detail/for_each_ref.hpp>
+#include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/monad.hpp>
+#include <boost/hana/tuple/functor.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Applicative
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct lift_impl<Tuple> {
+        template <typename X>
+        static constexpr _tuple<typename detail::std::decay<X>::type> apply(X&& x)
+        { return {detail::std::forward<X>(x)}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monad
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct flatten_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <int Which, Size ...Lengths>
+        struct flatten_indices {
+            template <typename Array>
+            constexpr auto operator()(Array outer) const {
+                constexpr Size lengths[] = {Lengths...};
+                Array inner = outer;
+                for (Size index = 0, i = 0; i < sizeof...(Lengths); ++i) {
+                    for (Size j = 0; j < lengths[i]; ++j, ++index) {
+                        inner[index] = i;
+                        outer[index] = j;
+                    }
+                }
+                return detail::get<Which>(hana::make<Tuple>(outer, inner));
+            }
+        };
+
+        template <typename Xs, Size ...outer, Size ...inner>
+        static constexpr decltype(auto)
+        flatten_helper(Xs&& xs, detail::std::index_sequence<outer...>,
+                                detail::std::index_sequence<inner...>)
+        {
+            return hana::make<Tuple>(detail::get<outer>(detail::get<inner>(
+                                        detail::std::forward<Xs>(xs)))...);
+        }
+        //! @todo
+        //! Use `Size` instead of `long long` for the `lengths` array.
+        //! The problem is that `hana::sum` does not allow the type of
+        //! the elements to be specified and it uses `int_<0>` as a base
+        //! value, so this won't work with an unsigned type.
+        #define BOOST_HANA_PP_FLATTEN(REF)                                      \
+            template <typename ...Xs>                                           \
+            static constexpr decltype(auto)                                     \
+            apply(detail::closure_impl<Xs...> REF xs) {                         \
+                constexpr /* Size */ long long lengths[] = {0,                  \
+                    tuple_detail::size<typename Xs::get_type>{}...              \
+                };                                                              \
+                constexpr Size total_length = hana::sum(lengths);               \
+                                                                                \
+                using Outer = flatten_indices<0,                                \
+                    tuple_detail::size<typename Xs::get_type>{}...              \
+                >;                                                              \
+                using Inner = flatten_indices<1,                                \
+                    tuple_detail::size<typename Xs::get_type>{}...              \
+                >;                                                              \
+                                                                                \
+                return flatten_helper(                                          \
+                    static_cast<detail::closure_impl<Xs...> REF>(xs),           \
+                    detail::generate_index_sequence<total_length, Outer>{},     \
+                    detail::generate_index_sequence<total_length, Inner>{});    \
+            }                                                                   \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_FLATTEN)
+        #undef BOOST_HANA_PP_FLATTEN
+
+        static constexpr _tuple<> apply(_tuple<> const&) { return {}; }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_MONAD_HPP
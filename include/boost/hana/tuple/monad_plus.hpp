@@ -0,0 +1,155 @@
+/*!
+@file
+Defines the model of `MonadPlus` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_MONAD_PLUS_HPP
+#define BOOST_HANA_TUPLE_MONAD_PLUS_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/detail/dependent_on.hpp>
+#include <boost/hana/detail/for_each_ref.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/tuple_predicates.hpp>
+#include <boost/hana/monad_plus.hpp>
+#include <boost/hana/tuple/monad.hpp>
+#include <boost/hana/type.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct filter_impl<Tuple> {
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(true_), Xs&& xs, Pred&&) {
+            return tuple_detail::gather(detail::std::forward<Xs>(xs),
+                                        tuple_detail::where<Results, true>{});
+        }
+
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            using Tpl = detail::dependent_on_t<sizeof(xs) == 1, Tuple>;
+            return filter_impl<Tpl, when<true>>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            using Results = tuple_detail::results_of<Xs, Pred>;
+            return helper<Results>(bool_<Results::is_constant()>,
+                                   detail::std::forward<Xs>(xs),
+                                   detail::std::forward<Pred>(pred));
+        }
+    };
+
+    template <>
+    struct concat_impl<Tuple> {
+        #define BOOST_HANA_PP_CONCAT(REF1, REF2)                            \
+            template <typename ...Xs, typename ...Ys>                       \
+            static constexpr _tuple<                                        \
+                typename Xs::get_type..., typename Ys::get_type...          \
+            > apply(detail::closure_impl<Xs...> REF1 xs,                    \
+                    detail::closure_impl<Ys...> REF2 ys)                    \
+            {                                                               \
+                return {static_cast<Xs REF1>(xs).get()...,                  \
+                        static_cast<Ys REF2>(ys).get()...};                 \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF2(BOOST_HANA_PP_CONCAT)
+        #undef BOOST_HANA_PP_CONCAT
+    };
+
+    template <>
+    struct empty_impl<Tuple> {
+        static constexpr _tuple<> apply()
+        { return {}; }
+    };
+
+    template <>
+    struct repeat_impl<Tuple> {
+        template <typename X>
+        static constexpr _tuple<>
+        repeat_helper(X&&, detail::std::index_sequence<>)
+        { return {}; }
+
+        template <typename X, detail::std::size_t i, detail::std::size_t ...j>
+        static constexpr _tuple<
+            typename detail::std::decay<X>::type,
+            typename detail::std::decay<tuple_detail::expand<!!j, X>>::type...
+        > repeat_helper(X&& x, detail::std::index_sequence<i, j...>)
+        { return {((void)j, x)..., detail::std::forward<X>(x)}; }
+
+        template <typename T, detail::std::size_t ...i>
+        static constexpr auto
+        repeat_helper(_type<T>, detail::std::index_sequence<i...>)
+        { return tuple_t<tuple_detail::expand<!!i, T>...>; }
+
+        template <typename N, typename X>
+        static constexpr decltype(auto) apply(N const&, X&& x) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return repeat_helper(detail::std::forward<X>(x),
+                                 detail::std::make_index_sequence<n>{});
+        }
+    };
+
+    template <>
+    struct cycle_impl<Tuple> {
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N&& n, Xs&& xs) {
+            return hana::flatten(hana::repeat<Tuple>(
+                detail::std::forward<N>(n),
+                detail::std::forward<Xs>(xs)
+            ));
+        }
+    };
+
+    template <>
+    struct prepend_impl<Tuple> {
+        #define BOOST_HANA_PP_PREPEND(REF)                                      \
+            template <typename X, typename ...Xs>                               \
+            static constexpr _tuple<                                            \
+                typename detail::std::decay<X>::type, typename Xs::get_type...  \
+            > apply(X&& x, detail::closure_impl<Xs...> REF xs) {                \
+                return {                                                        \
+                    detail::std::forward<X>(x),                                 \
+                    static_cast<Xs REF>(xs).get()...                            \
+                };                                                              \
+            }                                                                   \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_PREPEND)
+        #undef BOOST_HANA_PP_PREPEND
+    };
+
+    template <>
+    struct append_impl<Tuple> {
+        #define BOOST_HANA_PP_APPEND(REF)                                       \
+            template <typename ...Xs, typename X>                               \
+            static constexpr _tuple<                                            \
+                typename Xs::get_type..., typename detail::std::decay<X>::type  \
+            > apply(detail::closure_impl<Xs...> REF xs, X&& x) {                \
+                return {                                                        \
+                    static_cast<Xs REF>(xs).get()...,                           \
+                    detail::std::forward<X>(x)                                  \
+                };                                                              \
+            }                                                                   \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_APPEND)
+        #undef BOOST_HANA_PP_APPEND
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_MONAD_PLUS_HPP
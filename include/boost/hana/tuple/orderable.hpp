@@ -0,0 +1,107 @@
+/*!
+@file
+Defines the model of `Orderable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_ORDERABLE_HPP
+#define BOOST_HANA_TUPLE_ORDERABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/fast_and.hpp>
+#include <boost/hana/detail/first_difference.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/orderable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable
+    //////////////////////////////////////////////////////////////////////////
+    namespace tuple_detail {
+        // The three-way comparisons of the elements the tuples have in
+        // common, i.e. of their first `min(length(xs), length(ys))` elements.
+        template <typename Xs, typename Ys, typename =
+            detail::std::make_index_sequence<
+                (size<Xs>::value < size<Ys>::value ? size<Xs>::value
+                                                   : size<Ys>::value)
+            >>
+        struct orders;
+
+        template <typename Xs, typename Ys, detail::std::size_t ...i>
+        struct orders<Xs, Ys, detail::std::index_sequence<i...>> {
+            template <detail::std::size_t j>
+            using order = typename detail::std::decay<decltype(hana::compare(
+                detail::get<j>(detail::std::declval<Xs const&>()),
+                detail::get<j>(detail::std::declval<Ys const&>())
+            ))>::type;
+
+            using is_constant = detail::fast_and<
+                _models<Constant, typename datatype<order<i>>::type>{}...
+            >;
+
+            // The order of the tuples when their common elements are
+            // equivalent; the shortest tuple comes first.
+            static constexpr int length_order()
+            {
+                return (size<Xs>::value > size<Ys>::value) -
+                       (size<Xs>::value < size<Ys>::value);
+            }
+
+            static constexpr int value() {
+                constexpr int values[] = {
+                    static_cast<int>(hana::value<order<i>>())..., length_order()
+                };
+                return detail::first_difference(values);
+            }
+
+            // Compares the elements in order, until the first difference.
+            static constexpr int apply(Xs const& xs, Ys const& ys) {
+                int result = 0;
+                using swallow = int[];
+                (void)swallow{0, (result = result != 0 ? result :
+                    static_cast<int>(hana::compare(detail::get<i>(xs),
+                                                   detail::get<i>(ys)))
+                )...};
+                return result != 0 ? result : length_order();
+            }
+        };
+    }
+
+    template <>
+    struct compare_impl<Tuple, Tuple> {
+        template <typename Xs, typename Ys>
+        static constexpr auto helper(Xs const&, Ys const&, detail::std::true_type)
+        { return int_<tuple_detail::orders<Xs, Ys>::value()>; }
+
+        template <typename Xs, typename Ys>
+        static constexpr int
+        helper(Xs const& xs, Ys const& ys, detail::std::false_type)
+        { return tuple_detail::orders<Xs, Ys>::apply(xs, ys); }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs const& xs, Ys const& ys) {
+            return helper(xs, ys,
+                typename tuple_detail::orders<Xs, Ys>::is_constant{});
+        }
+    };
+
+    template <>
+    struct less_impl<Tuple, Tuple>
+        : Orderable::less_impl<Tuple, Tuple>
+    { };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_ORDERABLE_HPP
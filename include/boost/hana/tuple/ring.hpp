@@ -0,0 +1,92 @@
+/*!
+@file
+Defines the models of `Monoid`, `Group` and `Ring` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_RING_HPP
+#define BOOST_HANA_TUPLE_RING_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/group.hpp>
+#include <boost/hana/monoid.hpp>
+#include <boost/hana/ring.hpp>
+#include <boost/hana/tuple/functor.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Monoid, Group and Ring
+    //
+    // Tuples of the same length are added, subtracted and multiplied
+    // element-wise. Since the length of a tuple is not part of its data
+    // type, there is no `zero<Tuple>()` or `one<Tuple>()`.
+    //////////////////////////////////////////////////////////////////////////
+    namespace tuple_detail {
+        template <typename F, typename Xs, typename Ys, detail::std::size_t ...i>
+        constexpr decltype(auto)
+        zip_with_helper(F const& f, Xs&& xs, Ys&& ys,
+                        detail::std::index_sequence<i...>)
+        {
+            return hana::make<Tuple>(
+                f(detail::get<i>(detail::std::forward<Xs>(xs)),
+                  detail::get<i>(detail::std::forward<Ys>(ys)))...
+            );
+        }
+
+        // Applies `f` to the elements at the same index in two tuples,
+        // without creating a tuple of pairs like `zip` does.
+        template <typename F, typename Xs, typename Ys>
+        constexpr decltype(auto) zip_with(F const& f, Xs&& xs, Ys&& ys) {
+            constexpr detail::std::size_t n = tuple_detail::size<Xs>{};
+            static_assert(n == tuple_detail::size<Ys>{},
+            "boost::hana::plus, minus and mult require tuples of the same length");
+            return zip_with_helper(f, detail::std::forward<Xs>(xs),
+                                      detail::std::forward<Ys>(ys),
+                                      detail::std::make_index_sequence<n>{});
+        }
+    }
+
+    template <>
+    struct plus_impl<Tuple, Tuple> {
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs&& xs, Ys&& ys) {
+            return tuple_detail::zip_with(hana::plus,
+                detail::std::forward<Xs>(xs), detail::std::forward<Ys>(ys));
+        }
+    };
+
+    template <>
+    struct minus_impl<Tuple, Tuple> {
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs&& xs, Ys&& ys) {
+            return tuple_detail::zip_with(hana::minus,
+                detail::std::forward<Xs>(xs), detail::std::forward<Ys>(ys));
+        }
+    };
+
+    template <>
+    struct negate_impl<Tuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return hana::transform(detail::std::forward<Xs>(xs), negate); }
+    };
+
+    template <>
+    struct mult_impl<Tuple, Tuple> {
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs&& xs, Ys&& ys) {
+            return tuple_detail::zip_with(hana::mult,
+                detail::std::forward<Xs>(xs), detail::std::forward<Ys>(ys));
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_RING_HPP
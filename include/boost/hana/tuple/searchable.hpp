@@ -0,0 +1,66 @@
+/*!
+@file
+Defines the model of `Searchable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_SEARCHABLE_HPP
+#define BOOST_HANA_TUPLE_SEARCHABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/detail/dependent_on.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/tuple_predicates.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple/iterable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_if_impl<Tuple> {
+        template <typename Xs, detail::std::size_t i>
+        static constexpr auto found(decltype(true_), Xs&& xs)
+        { return hana::just(detail::get<i>(detail::std::forward<Xs>(xs))); }
+
+        template <typename Xs, detail::std::size_t i>
+        static constexpr auto found(decltype(false_), Xs&&)
+        { return nothing; }
+
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr auto helper(decltype(true_), Xs&& xs, Pred&&) {
+            constexpr detail::std::size_t i = Results::find(true);
+            constexpr bool is_found = i < tuple_detail::size<Xs>{};
+            return found<Xs, i>(bool_<is_found>, detail::std::forward<Xs>(xs));
+        }
+
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            using Tpl = detail::dependent_on_t<sizeof(xs) == 1, Tuple>;
+            return Iterable::find_if_impl<Tpl>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            using Results = tuple_detail::results_of<Xs, Pred>;
+            return helper<Results>(bool_<Results::is_constant()>,
+                                   detail::std::forward<Xs>(xs),
+                                   detail::std::forward<Pred>(pred));
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_SEARCHABLE_HPP
@@ -0,0 +1,679 @@
+/*!
+@file
+Defines the model of `Sequence` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_SEQUENCE_HPP
+#define BOOST_HANA_TUPLE_SEQUENCE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/array.hpp>
+#include <boost/hana/detail/dependent_on.hpp>
+#include <boost/hana/detail/for_each_ref.hpp>
+#include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/std/common_type.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/integral_constant.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/std/void_t.hpp>
+#include <boost/hana/detail/tuple_predicates.hpp>
+#include <boost/hana/functional/apply.hpp>
+#include <boost/hana/functional/curry.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/monad_plus.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple/comparable.hpp>
+#include <boost/hana/tuple/foldable.hpp>
+#include <boost/hana/tuple/functor.hpp>
+#include <boost/hana/tuple/iterable.hpp>
+#include <boost/hana/tuple/monad.hpp>
+#include <boost/hana/tuple/monad_plus.hpp>
+#include <boost/hana/tuple/orderable.hpp>
+#include <boost/hana/tuple/ring.hpp>
+#include <boost/hana/tuple/searchable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct models_impl<Sequence, Tuple>
+        : decltype(true_)
+    { };
+
+    template <>
+    struct init_impl<Tuple> {
+        template <typename Xs, detail::std::size_t ...n>
+        static constexpr decltype(auto)
+        init_helper(Xs&& xs, detail::std::index_sequence<n...>) {
+            return hana::make<Tuple>(
+                        detail::get<n>(detail::std::forward<Xs>(xs))...);
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            return init_helper(detail::std::forward<Xs>(xs),
+                detail::std::make_index_sequence<size - 1>{});
+        }
+    };
+
+    template <>
+    struct intersperse_impl<Tuple> {
+        template <detail::std::size_t i, typename Z, typename Xs>
+        static constexpr Z pick(Z&& z, Xs const&,
+            decltype(false_) /* odd index */)
+        { return detail::std::forward<Z>(z); }
+
+        template <detail::std::size_t i, typename Z, typename Xn>
+        static constexpr Xn const&
+        pick(Z const&, detail::element<(i + 1) / 2, Xn> const& x,
+            decltype(true_) /* even index */)
+        { return x.get(); }
+
+        template <detail::std::size_t i, typename Z, typename Xn>
+        static constexpr Xn&&
+        pick(Z const&, detail::element<(i + 1) / 2, Xn>&& x,
+            decltype(true_) /* even index */)
+        { return static_cast<detail::element<(i + 1) / 2, Xn>&&>(x).get(); }
+
+        template <typename Xs, typename Z, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        intersperse_helper(Xs&& xs, Z&& z, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(
+                pick<i>(
+                    detail::std::forward<Z>(z),
+                    detail::std::forward<Xs>(xs),
+                    bool_<(i % 2 == 0)>
+                )...
+            );
+        }
+
+        template <typename Xs, typename Z>
+        static constexpr decltype(auto) apply(Xs&& xs, Z&& z) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            constexpr auto new_seq_size = size == 0 ? 0 : (size * 2) - 1;
+            return intersperse_helper(detail::std::forward<Xs>(xs),
+                          detail::std::forward<Z>(z),
+                          detail::std::make_index_sequence<new_seq_size>{});
+        }
+    };
+
+    template <>
+    struct partition_impl<Tuple> {
+        // Each element goes to exactly one of the two parts, so it is fine
+        // to forward `xs` twice; no element is ever moved from twice.
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(true_), Xs&& xs, Pred&&) {
+            return hana::pair(
+                tuple_detail::gather(detail::std::forward<Xs>(xs),
+                                     tuple_detail::where<Results, true>{}),
+                tuple_detail::gather(detail::std::forward<Xs>(xs),
+                                     tuple_detail::where<Results, false>{})
+            );
+        }
+
+        template <typename Results, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(decltype(false_), Xs&& xs, Pred&& pred) {
+            using Tpl = detail::dependent_on_t<sizeof(xs) == 1, Tuple>;
+            return partition_impl<Tpl, when<true>>::apply(
+                detail::std::forward<Xs>(xs), detail::std::forward<Pred>(pred)
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            using Results = tuple_detail::results_of<Xs, Pred>;
+            return helper<Results>(bool_<Results::is_constant()>,
+                                   detail::std::forward<Xs>(xs),
+                                   detail::std::forward<Pred>(pred));
+        }
+    };
+
+    template <>
+    struct remove_at_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <typename Xs, Size ...before, Size ...after>
+        static constexpr decltype(auto)
+        remove_at_helper(Xs&& xs, detail::std::index_sequence<before...>,
+                                  detail::std::index_sequence<after...>)
+        {
+            return hana::make<Tuple>(
+                detail::get<before>(
+                    detail::std::forward<Xs>(xs)
+                )...,
+                detail::get<sizeof...(before) + after + 1>(
+                    detail::std::forward<Xs>(xs)
+                )...
+            );
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr Size index = hana::value<N>();
+            constexpr Size size = tuple_detail::size<Xs>{};
+            return remove_at_helper(detail::std::forward<Xs>(xs),
+                          detail::std::make_index_sequence<index>{},
+                          detail::std::make_index_sequence<size - index - 1>{});
+        }
+    };
+
+    template <>
+    struct reverse_impl<Tuple> {
+        template <detail::std::size_t ...n, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(detail::closure_impl<detail::element<n, Xn>...>&& xs) {
+            using Closure = detail::closure_impl<detail::element<n, Xn>...>;
+            return hana::make<Tuple>(detail::get<sizeof...(n) - n - 1>(
+                                            static_cast<Closure&&>(xs))...);
+        }
+
+        template <detail::std::size_t ...n, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(detail::closure_impl<detail::element<n, Xn>...> const& xs) {
+            return hana::make<Tuple>(detail::get<sizeof...(n) - n - 1>(xs)...);
+        }
+    };
+
+    template <>
+    struct slice_impl<Tuple> {
+        template <detail::std::size_t from, typename Xs, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        slice_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(detail::get<from + i>(
+                                        detail::std::forward<Xs>(xs))...);
+        }
+
+        template <typename Xs, typename From, typename To>
+        static constexpr decltype(auto) apply(Xs&& xs, From const&, To const&) {
+            constexpr detail::std::size_t from = hana::value<From>();
+            constexpr detail::std::size_t to = hana::value<To>();
+            return slice_helper<from>(detail::std::forward<Xs>(xs),
+                                detail::std::make_index_sequence<to - from>{});
+        }
+    };
+
+    template <>
+    struct sort_by_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        // Stable bottom-up merge sort of the indices `[0, N)` of a tuple.
+        // `Less{}(i, j)` must tell whether the `i`-th element of the tuple
+        // should come before its `j`-th element. The permutation is computed
+        // at compile-time, so the tuple can then be rebuilt in a single step.
+        template <typename Less>
+        struct sorted_indices {
+            template <typename Array>
+            constexpr auto operator()(Array indices) const {
+                constexpr Less less{};
+                Size const n = indices.size();
+                Array merged = indices;
+                for (Size width = 1; width < n; width *= 2) {
+                    for (Size lo = 0; lo < n; lo += 2 * width) {
+                        Size mid = lo + width < n ? lo + width : n;
+                        Size hi = lo + 2 * width < n ? lo + 2 * width : n;
+                        Size i = lo, j = mid, k = lo;
+                        while (i < mid && j < hi)
+                            merged[k++] = less(indices[j], indices[i])
+                                            ? indices[j++] : indices[i++];
+                        while (i < mid) merged[k++] = indices[i++];
+                        while (j < hi)  merged[k++] = indices[j++];
+                    }
+                    for (Size k = 0; k < n; ++k)
+                        indices[k] = merged[k];
+                }
+                return indices;
+            }
+        };
+
+        // Stable merge sort of the indices of a tuple, done on types so that
+        // `Less::apply<i, j>()` is only instantiated for the pairs of elements
+        // which are actually compared, i.e. O(N log N) times.
+        template <typename Less, typename Left, typename Right,
+                  typename Sorted = detail::std::index_sequence<>>
+        struct merge;
+
+        template <bool take_right, typename Less, typename Left,
+                  typename Right, typename Sorted>
+        struct merge_step;
+
+        template <typename Less, Size ...i, Size ...k>
+        struct merge<Less, detail::std::index_sequence<i...>,
+                           detail::std::index_sequence<>,
+                           detail::std::index_sequence<k...>>
+        { using type = detail::std::index_sequence<k..., i...>; };
+
+        template <typename Less, Size j, Size ...js, Size ...k>
+        struct merge<Less, detail::std::index_sequence<>,
+                           detail::std::index_sequence<j, js...>,
+                           detail::std::index_sequence<k...>>
+        { using type = detail::std::index_sequence<k..., j, js...>; };
+
+        template <typename Less, Size i, Size ...is, Size j, Size ...js,
+                  typename Sorted>
+        struct merge<Less, detail::std::index_sequence<i, is...>,
+                           detail::std::index_sequence<j, js...>, Sorted>
+            : merge_step<Less::template apply<j, i>(), Less,
+                         detail::std::index_sequence<i, is...>,
+                         detail::std::index_sequence<j, js...>, Sorted>
+        { };
+
+        template <typename Less, Size i, Size ...is, Size j, Size ...js,
+                  Size ...k>
+        struct merge_step<true, Less, detail::std::index_sequence<i, is...>,
+                                      detail::std::index_sequence<j, js...>,
+                                      detail::std::index_sequence<k...>>
+            : merge<Less, detail::std::index_sequence<i, is...>,
+                          detail::std::index_sequence<js...>,
+                          detail::std::index_sequence<k..., j>>
+        { };
+
+        template <typename Less, Size i, Size ...is, Size j, Size ...js,
+                  Size ...k>
+        struct merge_step<false, Less, detail::std::index_sequence<i, is...>,
+                                       detail::std::index_sequence<j, js...>,
+                                       detail::std::index_sequence<k...>>
+            : merge<Less, detail::std::index_sequence<is...>,
+                          detail::std::index_sequence<j, js...>,
+                          detail::std::index_sequence<k..., i>>
+        { };
+
+        template <typename Less, Size from, Size n>
+        struct merge_sort
+            : merge<Less, typename merge_sort<Less, from, n / 2>::type,
+                          typename merge_sort<Less, from + n / 2, n - n / 2>::type>
+        { };
+
+        template <typename Less, Size from>
+        struct merge_sort<Less, from, 1>
+        { using type = detail::std::index_sequence<from>; };
+
+        template <typename Less, Size from>
+        struct merge_sort<Less, from, 0>
+        { using type = detail::std::index_sequence<>; };
+
+        template <typename Pred, typename Xs, Size i, Size j>
+        using result = typename detail::std::decay<decltype(
+            detail::std::declval<Pred&>()(
+                detail::get<i>(detail::std::declval<Xs&>()),
+                detail::get<j>(detail::std::declval<Xs&>())
+            )
+        )>::type;
+
+        template <typename Pred, typename Xs>
+        struct less_by {
+            template <Size i, Size j>
+            static constexpr bool apply()
+            { return static_cast<bool>(hana::value<result<Pred, Xs, i, j>>()); }
+        };
+
+        // Whether the tuple can be sorted at compile-time. This is decided by
+        // checking that `pred` returns a `Constant` on the first two elements
+        // only, which is the same requirement as for the other comparisons.
+        template <typename Pred, typename Xs, typename = void>
+        struct returns_constant
+            : detail::std::false_type
+        { };
+
+        template <typename Pred, typename Xs>
+        struct returns_constant<Pred, Xs,
+            detail::std::void_t<result<Pred, Xs, 0, 1>>
+        >
+            : _models<Constant, typename datatype<result<Pred, Xs, 0, 1>>::type>
+        { };
+
+        template <typename Pred, typename Xs>
+        using is_constant = detail::std::integral_constant<bool,
+            (Xs::size < 2) || returns_constant<Pred, Xs>::value
+        >;
+
+        template <typename Less, typename Xs>
+        static constexpr decltype(auto) sort_with(Xs&& xs) {
+            constexpr Size size = tuple_detail::size<Xs>{};
+            return tuple_detail::gather(detail::std::forward<Xs>(xs),
+                detail::generate_index_sequence<size, sorted_indices<Less>>{});
+        }
+
+        template <typename Less, typename Pred, typename Xs>
+        static constexpr decltype(auto)
+        sort_helper(decltype(true_), Pred&&, Xs&& xs) {
+            constexpr Size size = tuple_detail::size<Xs>{};
+            return tuple_detail::gather(detail::std::forward<Xs>(xs),
+                typename merge_sort<Less, 0, size>::type{});
+        }
+
+        template <typename Less, typename Pred, typename Xs>
+        static constexpr decltype(auto)
+        sort_helper(decltype(false_), Pred&& pred, Xs&& xs) {
+            using Tpl = detail::dependent_on_t<sizeof(xs) == 1, Tuple>;
+            return sort_by_impl<Tpl, when<true>>::apply(
+                detail::std::forward<Pred>(pred), detail::std::forward<Xs>(xs)
+            );
+        }
+
+        template <typename Pred, typename ...X>
+        static constexpr decltype(auto)
+        apply(Pred&& pred, _tuple<X...> const& xs) {
+            using P = typename detail::std::decay<Pred>::type;
+            return sort_helper<less_by<P, _tuple<X...>>>(
+                bool_<is_constant<P, _tuple<X...>>{}>,
+                detail::std::forward<Pred>(pred), xs
+            );
+        }
+
+        template <typename Pred, typename ...X>
+        static constexpr decltype(auto)
+        apply(Pred&& pred, _tuple<X...>&& xs) {
+            using P = typename detail::std::decay<Pred>::type;
+            return sort_helper<less_by<P, _tuple<X...>>>(
+                bool_<is_constant<P, _tuple<X...>>{}>,
+                detail::std::forward<Pred>(pred), detail::std::move(xs)
+            );
+        }
+    };
+
+    template <>
+    struct sort_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <typename T, T ...v>
+        struct less_values {
+            detail::array<T, sizeof...(v)> values = {{v...}};
+
+            constexpr bool operator()(Size i, Size j) const
+            { return values[i] < values[j]; }
+        };
+
+        // Tuples of `Constant`s holding integral values of different types
+        // are sorted by comparing the values in their common type, which is
+        // what `less` does, without instantiating `less` on each pair.
+        template <typename ...X>
+        struct less_constants {
+            template <typename Y, typename Z>
+            static constexpr bool less(Y y, Z z) {
+                using C = typename detail::std::common_type<Y, Z>::type;
+                return static_cast<C>(y) < static_cast<C>(z);
+            }
+
+            template <typename Y>
+            static constexpr detail::array<bool, sizeof...(X)> row()
+            { return {{less(hana::value<Y>(), hana::value<X>())...}}; }
+
+            detail::array<detail::array<bool, sizeof...(X)>, sizeof...(X)>
+                table = {{row<X>()...}};
+
+            constexpr bool operator()(Size i, Size j) const
+            { return table[i][j]; }
+        };
+
+        template <typename X, bool = _models<Constant,
+                                             typename datatype<X>::type>{}>
+        struct value_type { using type = void; };
+
+        template <typename X>
+        struct value_type<X, true> {
+            using type = typename detail::std::decay<
+                decltype(hana::value<X>())
+            >::type;
+        };
+
+        template <typename ...X>
+        using integral_values = detail::std::is_same<
+            detail::std::integer_sequence<bool, true,
+                detail::std::is_integral<typename value_type<X>::type>{}...
+            >,
+            detail::std::integer_sequence<bool,
+                detail::std::is_integral<typename value_type<X>::type>{}...,
+                true
+            >
+        >;
+
+        template <typename ...X>
+        static constexpr decltype(auto)
+        sort_helper(decltype(true_), _tuple<X...> const& xs) {
+            return sort_by_impl<Tuple>::sort_with<less_constants<X...>>(xs);
+        }
+
+        template <typename ...X>
+        static constexpr decltype(auto)
+        sort_helper(decltype(false_), _tuple<X...> const& xs)
+        { return hana::sort_by(less, xs); }
+
+        template <typename ...X>
+        static constexpr decltype(auto)
+        sort_helper(decltype(false_), _tuple<X...>&& xs)
+        { return hana::sort_by(less, detail::std::move(xs)); }
+
+        template <typename ...X>
+        static constexpr decltype(auto) apply(_tuple<X...> const& xs) {
+            return sort_helper(bool_<integral_values<X...>{}>, xs);
+        }
+
+        template <typename ...X>
+        static constexpr decltype(auto) apply(_tuple<X...>&& xs) {
+            return sort_helper(bool_<integral_values<X...>{}>,
+                               detail::std::move(xs));
+        }
+
+        template <typename T, T ...v>
+        static constexpr decltype(auto)
+        apply(_tuple<_integral_constant<T, v>...> const& xs) {
+            return sort_by_impl<Tuple>::sort_with<less_values<T, v...>>(xs);
+        }
+
+        template <typename T, T ...v>
+        static constexpr decltype(auto)
+        apply(_tuple<_integral_constant<T, v>...>&& xs) {
+            return sort_by_impl<Tuple>::sort_with<less_values<T, v...>>(
+                                                        detail::std::move(xs));
+        }
+
+        template <typename T, T ...v, Size ...i>
+        static constexpr auto
+        sort_helper(_tuple_c<T, v...>, detail::std::index_sequence<i...>) {
+            constexpr detail::array<T, sizeof...(v)> values = {{v...}};
+            return tuple_c<T, values[i]...>;
+        }
+
+        template <typename T, T ...v>
+        static constexpr auto apply(_tuple_c<T, v...> const& xs) {
+            return sort_helper(xs, detail::generate_index_sequence<
+                sizeof...(v), sort_by_impl<Tuple>::sorted_indices<
+                    less_values<T, v...>
+                >
+            >{});
+        }
+    };
+
+    template <>
+    struct take_at_most_impl<Tuple> {
+        template <typename Xs, detail::std::size_t ...n>
+        static constexpr decltype(auto)
+        take_helper(Xs&& xs, detail::std::index_sequence<n...>) {
+            return hana::make<Tuple>(detail::get<n>(
+                                            detail::std::forward<Xs>(xs))...);
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            return take_helper(detail::std::forward<Xs>(xs),
+                detail::std::make_index_sequence<(n < size ? n : size)>{});
+        }
+    };
+
+    template <>
+    struct unzip_impl<Tuple> {
+        #define BOOST_HANA_PP_UNZIP(REF)                                    \
+            template <typename ...Xs>                                       \
+            static constexpr decltype(auto)                                 \
+            apply(detail::closure_impl<Xs...> REF xs)                       \
+            { return hana::zip(static_cast<Xs REF>(xs).get()...); }         \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_UNZIP)
+        #undef BOOST_HANA_PP_UNZIP
+    };
+
+    template <>
+    struct zip_unsafe_with_impl<Tuple> {
+        #define BOOST_HANA_PP_ZIP_WITH1(REF)                                \
+            template <typename F, typename ...Xs>                           \
+            static constexpr decltype(auto) apply(F&& f,                    \
+                detail::closure_impl<Xs...> REF xs)                         \
+            {                                                               \
+                return hana::make<Tuple>(                                   \
+                    f(static_cast<Xs REF>(xs).get())...                     \
+                );                                                          \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_ZIP_WITH1)
+        #undef BOOST_HANA_PP_ZIP_WITH1
+
+        #define BOOST_HANA_PP_ZIP_WITH2(REF1, REF2)                         \
+            template <typename F, typename ...Xs, typename ...Ys>           \
+            static constexpr decltype(auto) apply(F&& f,                    \
+                detail::closure_impl<Xs...> REF1 xs,                        \
+                detail::closure_impl<Ys...> REF2 ys)                        \
+            {                                                               \
+                return hana::make<Tuple>(                                   \
+                    f(static_cast<Xs REF1>(xs).get(),                       \
+                      static_cast<Ys REF2>(ys).get())...                    \
+                );                                                          \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF2(BOOST_HANA_PP_ZIP_WITH2)
+        #undef BOOST_HANA_PP_ZIP_WITH2
+
+        #define BOOST_HANA_PP_ZIP_WITH3(REF1, REF2, REF3)                         \
+            template <typename F, typename ...Xs, typename ...Ys, typename ...Zs> \
+            static constexpr decltype(auto) apply(F&& f,                          \
+                detail::closure_impl<Xs...> REF1 xs,                              \
+                detail::closure_impl<Ys...> REF2 ys,                              \
+                detail::closure_impl<Zs...> REF3 zs)                              \
+            {                                                                     \
+                return hana::make<Tuple>(                                         \
+                    f(static_cast<Xs REF1>(xs).get(),                             \
+                      static_cast<Ys REF2>(ys).get(),                             \
+                      static_cast<Zs REF3>(zs).get())...                          \
+                );                                                                \
+            }                                                                     \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF3(BOOST_HANA_PP_ZIP_WITH3)
+        #undef BOOST_HANA_PP_ZIP_WITH3
+
+        template <typename F, typename X1, typename X2, typename X3, typename X4, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(F&& f, X1&& x1, X2&& x2, X3&& x3, X4&& x4, Xn&& ...xn) {
+            return apply(hana::apply,
+                apply(
+                    curry<sizeof...(xn) + 4>(detail::std::forward<F>(f)),
+                    detail::std::forward<X1>(x1),
+                    detail::std::forward<X2>(x2),
+                    detail::std::forward<X3>(x3)
+                ),
+                detail::std::forward<X4>(x4),
+                detail::std::forward<Xn>(xn)...
+            );
+        }
+    };
+
+    template <>
+    struct zip_unsafe_impl<Tuple> {
+        #define BOOST_HANA_PP_ZIP1(REF)                                     \
+            template <typename ...Xs>                                       \
+            static constexpr _tuple<                                        \
+                _tuple<typename Xs::get_type>...                            \
+            > apply(detail::closure_impl<Xs...> REF xs) {                   \
+                return {                                                    \
+                    _tuple<typename Xs::get_type>{                          \
+                        static_cast<Xs REF>(xs).get()                       \
+                    }...                                                    \
+                };                                                          \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF1(BOOST_HANA_PP_ZIP1)
+        #undef BOOST_HANA_PP_ZIP1
+
+        #define BOOST_HANA_PP_ZIP2(REF1, REF2)                              \
+            template <typename ...Xs, typename ...Ys>                       \
+            static constexpr _tuple<                                        \
+                _tuple<typename Xs::get_type,                               \
+                       typename Ys::get_type>...                            \
+            > apply(detail::closure_impl<Xs...> REF1 xs,                    \
+                         detail::closure_impl<Ys...> REF2 ys) {             \
+                return {                                                    \
+                    _tuple<typename Xs::get_type,                           \
+                           typename Ys::get_type>{                          \
+                        static_cast<Xs REF1>(xs).get(),                     \
+                        static_cast<Ys REF2>(ys).get()                      \
+                    }...                                                    \
+                };                                                          \
+            }                                                               \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF2(BOOST_HANA_PP_ZIP2)
+        #undef BOOST_HANA_PP_ZIP2
+
+        #define BOOST_HANA_PP_ZIP3(REF1, REF2, REF3)                    \
+            template <typename ...Xs, typename ...Ys, typename ...Zs>   \
+            static constexpr _tuple<                                    \
+                _tuple<typename Xs::get_type,                           \
+                       typename Ys::get_type,                           \
+                       typename Zs::get_type>...                        \
+            > apply(detail::closure_impl<Xs...> REF1 xs,                \
+                         detail::closure_impl<Ys...> REF2 ys,           \
+                         detail::closure_impl<Zs...> REF3 zs) {         \
+                return {                                                \
+                    _tuple<typename Xs::get_type,                       \
+                           typename Ys::get_type,                       \
+                           typename Zs::get_type>{                      \
+                        static_cast<Xs REF1>(xs).get(),                 \
+                        static_cast<Ys REF2>(ys).get(),                 \
+                        static_cast<Zs REF3>(zs).get()                  \
+                    }...                                                \
+                };                                                      \
+            }                                                           \
+        /**/
+        BOOST_HANA_PP_FOR_EACH_REF3(BOOST_HANA_PP_ZIP3)
+        #undef BOOST_HANA_PP_ZIP3
+
+        template <typename X1, typename X2, typename X3, typename X4, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(X1&& x1, X2&& x2, X3&& x3, X4&& x4, Xn&& ...xn) {
+            return hana::zip.with(concat,
+                apply(
+                    detail::std::forward<X1>(x1),
+                    detail::std::forward<X2>(x2),
+                    detail::std::forward<X3>(x3)
+                ),
+                apply(
+                    detail::std::forward<X4>(x4),
+                    detail::std::forward<Xn>(xn)...
+                )
+            );
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_SEQUENCE_HPP
@@ -0,0 +1,443 @@
+/*!
+@file
+Defines `boost::hana::View`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_VIEW_HPP
+#define BOOST_HANA_VIEW_HPP
+
+#include <boost/hana/fwd/view.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/convert.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/make.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/forward.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_lvalue_reference.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Views
+    //
+    // Every view provides its number of elements as `size`, and its `n`th
+    // element with `get<n>()`. Views only hold other views by value, except
+    // for `_tuple_view` which refers to the elements `[from, to)` of a
+    // `_tuple` through a pointer.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename Xs,
+              detail::std::size_t from = 0,
+              detail::std::size_t to = detail::std::remove_cv<Xs>::type::size>
+    struct _tuple_view
+        : operators::adl
+        , operators::Iterable_ops<_tuple_view<Xs, from, to>>
+    {
+        Xs* xs;
+
+        explicit constexpr _tuple_view(Xs& xs_) : xs(&xs_) { }
+
+        static constexpr detail::std::size_t size = to - from;
+
+        template <detail::std::size_t n>
+        constexpr decltype(auto) get() const
+        { return detail::get<from + n>(*xs); }
+
+        using hana = _tuple_view;
+        using datatype = View;
+    };
+
+    template <typename V, typename F>
+    struct _transformed_view
+        : operators::adl
+        , operators::Iterable_ops<_transformed_view<V, F>>
+    {
+        V base;
+        F f;
+
+        template <typename F_>
+        constexpr _transformed_view(V const& base_, F_&& f_)
+            : base(base_), f(detail::std::forward<F_>(f_))
+        { }
+
+        static constexpr detail::std::size_t size = V::size;
+
+        template <detail::std::size_t n>
+        constexpr decltype(auto) get() const
+        { return f(base.template get<n>()); }
+
+        using hana = _transformed_view;
+        using datatype = View;
+    };
+
+    template <typename V, typename Indices>
+    struct _sliced_view;
+
+    template <typename V, detail::std::size_t ...i>
+    struct _sliced_view<V, detail::std::index_sequence<i...>>
+        : operators::adl
+        , operators::Iterable_ops<
+            _sliced_view<V, detail::std::index_sequence<i...>>
+        >
+    {
+        V base;
+
+        explicit constexpr _sliced_view(V const& base_) : base(base_) { }
+
+        static constexpr detail::std::size_t size = sizeof...(i);
+
+        // Index in `base` of the `n`th element of the view.
+        static constexpr detail::std::size_t index(detail::std::size_t n) {
+            detail::std::size_t const indices[] = {i..., 0};
+            return indices[n];
+        }
+
+        template <detail::std::size_t n>
+        constexpr decltype(auto) get() const
+        { return base.template get<index(n)>(); }
+
+        using hana = _sliced_view;
+        using datatype = View;
+    };
+
+    template <typename V1, typename V2>
+    struct _joined_view
+        : operators::adl
+        , operators::Iterable_ops<_joined_view<V1, V2>>
+    {
+        V1 first;
+        V2 second;
+
+        constexpr _joined_view(V1 const& first_, V2 const& second_)
+            : first(first_), second(second_)
+        { }
+
+        static constexpr detail::std::size_t size = V1::size + V2::size;
+
+        template <detail::std::size_t n>
+        constexpr decltype(auto) get_helper(decltype(true_)) const
+        { return first.template get<n>(); }
+
+        template <detail::std::size_t n>
+        constexpr decltype(auto) get_helper(decltype(false_)) const
+        { return second.template get<n - V1::size>(); }
+
+        template <detail::std::size_t n>
+        constexpr decltype(auto) get() const
+        { return get_helper<n>(bool_<(n < V1::size)>); }
+
+        using hana = _joined_view;
+        using datatype = View;
+    };
+
+    namespace view_detail {
+        // Returns a view of a `_tuple` or of another view.
+        template <typename Xs, typename = typename datatype<Xs>::type>
+        struct make_view;
+
+        template <typename Xs>
+        struct make_view<Xs, View> {
+            using type = typename detail::std::decay<Xs>::type;
+
+            static constexpr type apply(type const& v)
+            { return v; }
+        };
+
+        template <typename Xs>
+        struct make_view<Xs, Tuple> {
+            static_assert(detail::std::is_lvalue_reference<Xs>{},
+            "hana views do not own the elements of the tuples they refer to, "
+            "so they can't be created from temporary tuples");
+
+            using Tuple_ = typename detail::std::remove_reference<Xs>::type;
+            using type = _tuple_view<Tuple_>;
+
+            static constexpr type apply(Tuple_& xs)
+            { return type{xs}; }
+        };
+
+        template <typename Xs>
+        constexpr typename make_view<Xs>::type view_of(Xs&& xs)
+        { return make_view<Xs>::apply(detail::std::forward<Xs>(xs)); }
+
+        template <typename Xs>
+        using view_t = typename make_view<Xs>::type;
+
+        // Returns a view of the elements of `v` at the given indices. Slices
+        // of slices refer directly to the underlying view, so that repeated
+        // calls to `tail` or `drop` don't nest views.
+        template <typename V, typename Indices>
+        struct slice {
+            using type = _sliced_view<V, Indices>;
+
+            static constexpr type apply(V const& v)
+            { return type{v}; }
+        };
+
+        template <typename V, detail::std::size_t ...j, detail::std::size_t ...i>
+        struct slice<
+            _sliced_view<V, detail::std::index_sequence<j...>>,
+            detail::std::index_sequence<i...>
+        > {
+            using Base = _sliced_view<V, detail::std::index_sequence<j...>>;
+            using type = _sliced_view<V,
+                detail::std::index_sequence<Base::index(i)...>
+            >;
+
+            static constexpr type apply(Base const& v)
+            { return type{v.base}; }
+        };
+
+        template <detail::std::size_t from, typename Indices>
+        struct offset;
+
+        template <detail::std::size_t from, detail::std::size_t ...i>
+        struct offset<from, detail::std::index_sequence<i...>> {
+            using type = detail::std::index_sequence<from + i...>;
+        };
+
+        template <detail::std::size_t from, detail::std::size_t to>
+        using interval = typename offset<
+            from, detail::std::make_index_sequence<to - from>
+        >::type;
+
+        // Returns a view of the elements of `v` in `[from, to)`. Subranges
+        // of a `_tuple_view` only move its offsets, so `tail`, `drop` and
+        // `sliced` don't create a list of indices for them.
+        template <typename V, detail::std::size_t from, detail::std::size_t to>
+        struct subrange
+            : slice<V, interval<from, to>>
+        { };
+
+        template <typename Xs, detail::std::size_t i, detail::std::size_t j,
+                  detail::std::size_t from, detail::std::size_t to>
+        struct subrange<_tuple_view<Xs, i, j>, from, to> {
+            using type = _tuple_view<Xs, i + from, i + to>;
+
+            static constexpr type apply(_tuple_view<Xs, i, j> const& v)
+            { return type{*v.xs}; }
+        };
+
+        template <typename Indices>
+        struct reverse;
+
+        template <detail::std::size_t ...i>
+        struct reverse<detail::std::index_sequence<i...>> {
+            using type = detail::std::index_sequence<sizeof...(i) - i - 1 ...>;
+        };
+
+        template <typename V, typename Pred, typename Indices>
+        struct filter;
+
+        template <typename V, typename Pred, detail::std::size_t ...n>
+        struct filter<V, Pred, detail::std::index_sequence<n...>> {
+            using Results = tuple_detail::predicate_results<Pred,
+                decltype(detail::std::declval<V const&>().template get<n>())...
+            >;
+
+            static_assert(Results::is_constant(),
+            "hana::filtered(xs, pred) requires pred to return a Constant "
+            "for every element of xs");
+
+            using type = tuple_detail::where<Results, true>;
+        };
+    }
+
+    //! @cond
+    template <typename Xs>
+    constexpr auto _viewed::operator()(Xs&& xs) const
+    { return view_detail::view_of(detail::std::forward<Xs>(xs)); }
+
+    template <typename Xs, typename F>
+    constexpr auto _transformed::operator()(Xs&& xs, F&& f) const {
+        using V = view_detail::view_t<Xs>;
+        return _transformed_view<V, typename detail::std::decay<F>::type>{
+            view_detail::view_of(detail::std::forward<Xs>(xs)),
+            detail::std::forward<F>(f)
+        };
+    }
+
+    template <typename Xs, typename Pred>
+    constexpr auto _filtered::operator()(Xs&& xs, Pred&&) const {
+        using V = view_detail::view_t<Xs>;
+        using Indices = typename view_detail::filter<V,
+            typename detail::std::decay<Pred>::type,
+            detail::std::make_index_sequence<V::size>
+        >::type;
+        return view_detail::slice<V, Indices>::apply(
+            view_detail::view_of(detail::std::forward<Xs>(xs))
+        );
+    }
+
+    template <typename Xs, typename From, typename To>
+    constexpr auto
+    _sliced::operator()(Xs&& xs, From const&, To const&) const {
+        using V = view_detail::view_t<Xs>;
+        constexpr detail::std::size_t from = hana::value<From>();
+        constexpr detail::std::size_t to = hana::value<To>();
+        static_assert(from <= to && to <= V::size,
+        "hana::sliced(xs, from, to) requires from <= to <= length(xs)");
+        return view_detail::subrange<V, from, to>::apply(
+            view_detail::view_of(detail::std::forward<Xs>(xs))
+        );
+    }
+
+    template <typename Xs>
+    constexpr auto _reversed::operator()(Xs&& xs) const {
+        using V = view_detail::view_t<Xs>;
+        using Indices = typename view_detail::reverse<
+            detail::std::make_index_sequence<V::size>
+        >::type;
+        return view_detail::slice<V, Indices>::apply(
+            view_detail::view_of(detail::std::forward<Xs>(xs))
+        );
+    }
+
+    template <typename Xs, typename Ys>
+    constexpr auto _joined::operator()(Xs&& xs, Ys&& ys) const {
+        return _joined_view<view_detail::view_t<Xs>, view_detail::view_t<Ys>>{
+            view_detail::view_of(detail::std::forward<Xs>(xs)),
+            view_detail::view_of(detail::std::forward<Ys>(ys))
+        };
+    }
+    //! @endcond
+
+    //////////////////////////////////////////////////////////////////////////
+    // Operators
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct operators::of<View>
+        : operators::of<Iterable>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<View> {
+        template <typename V, typename F, detail::std::size_t ...n>
+        static constexpr decltype(auto)
+        unpack_helper(V const& v, F&& f, detail::std::index_sequence<n...>)
+        { return detail::std::forward<F>(f)(v.template get<n>()...); }
+
+        template <typename V, typename F>
+        static constexpr decltype(auto) apply(V const& v, F&& f) {
+            return unpack_helper(v, detail::std::forward<F>(f),
+                                 detail::std::make_index_sequence<V::size>{});
+        }
+    };
+
+    template <>
+    struct length_impl<View> {
+        template <typename V>
+        static constexpr auto apply(V const&)
+        { return size_t<V::size>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct head_impl<View> {
+        template <typename V>
+        static constexpr decltype(auto) apply(V const& v)
+        { return v.template get<0>(); }
+    };
+
+    template <>
+    struct tail_impl<View> {
+        template <typename V>
+        static constexpr auto apply(V const& v)
+        { return view_detail::subrange<V, 1, V::size>::apply(v); }
+    };
+
+    template <>
+    struct uncons_impl<View> {
+        template <typename V>
+        static constexpr auto apply(V const& v) {
+            // The head is kept as returned by the view, so it still refers
+            // to the element instead of being copied.
+            using Head = decltype(v.template get<0>());
+            using Tail = view_detail::subrange<V, 1, V::size>;
+            return _pair<Head, typename Tail::type>{
+                v.template get<0>(), Tail::apply(v)
+            };
+        }
+    };
+
+    template <>
+    struct is_empty_impl<View> {
+        template <typename V>
+        static constexpr auto apply(V const&)
+        { return bool_<V::size == 0>; }
+    };
+
+    template <>
+    struct at_impl<View> {
+        template <typename N, typename V>
+        static constexpr decltype(auto) apply(N const&, V const& v) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return v.template get<n>();
+        }
+    };
+
+    template <>
+    struct last_impl<View> {
+        template <typename V>
+        static constexpr decltype(auto) apply(V const& v)
+        { return v.template get<V::size - 1>(); }
+    };
+
+    template <>
+    struct drop_impl<View> {
+        template <typename N, typename V>
+        static constexpr auto apply(N const&, V const& v) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t from = n < V::size ? n : V::size;
+            return view_detail::subrange<V, from, V::size>::apply(v);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_if_impl<View>
+        : Iterable::find_if_impl<View>
+    { };
+
+    template <>
+    struct any_of_impl<View>
+        : Iterable::any_of_impl<View>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversion to Tuple
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct to_impl<Tuple, View> {
+        template <typename V>
+        static constexpr decltype(auto) apply(V const& v)
+        { return hana::unpack(v, make<Tuple>); }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_VIEW_HPP
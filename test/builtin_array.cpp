@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/always.hpp>
 #include <boost/hana/functional/placeholder.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/logical.hpp>
 #include <boost/hana/maybe.hpp>
 #include <boost/hana/searchable.hpp>
@@ -63,6 +64,50 @@ int main() {
             ));
         }
 
+        // sum, product, minimum, maximum, count and count_if
+        {
+            // make sure we go through several blocks of lanes and a tail
+            int xs[100] = {};
+            for (int i = 0; i < 100; ++i)
+                xs[i] = (i * 37) % 101;
+
+            int expected_sum = 0, expected_min = xs[0], expected_max = xs[0];
+            std::size_t expected_odd = 0;
+            for (int x : xs) {
+                expected_sum += x;
+                expected_min = x < expected_min ? x : expected_min;
+                expected_max = expected_max < x ? x : expected_max;
+                expected_odd += x % 2 != 0;
+            }
+
+            BOOST_HANA_RUNTIME_CHECK(sum(xs) == expected_sum);
+            BOOST_HANA_RUNTIME_CHECK(minimum(xs) == expected_min);
+            BOOST_HANA_RUNTIME_CHECK(maximum(xs) == expected_max);
+            BOOST_HANA_RUNTIME_CHECK(count_if(xs, [](int x) {
+                return x % 2 != 0;
+            }) == expected_odd);
+            BOOST_HANA_RUNTIME_CHECK(count(xs, xs[42]) == 1);
+
+            char cs[] = {100, 100, 100};
+            BOOST_HANA_RUNTIME_CHECK(sum(cs) == 300);
+
+            double ds[] = {0.5, 1.5, 2.5, 3.5, 4.5};
+            BOOST_HANA_RUNTIME_CHECK(sum(ds) == 12.5);
+            BOOST_HANA_RUNTIME_CHECK(maximum(ds) == 4.5);
+
+            BOOST_HANA_CONSTEXPR_CHECK(sum(array<int, 4>{1, 2, 3, 4}) == 10);
+            BOOST_HANA_CONSTEXPR_CHECK(product(array<int, 4>{1, 2, 3, 4}) == 24);
+            BOOST_HANA_CONSTEXPR_CHECK(minimum(array<int, 4>{3, 1, 4, 2}) == 1);
+            BOOST_HANA_CONSTEXPR_CHECK(maximum(array<int, 4>{3, 1, 4, 2}) == 4);
+            BOOST_HANA_CONSTEXPR_CHECK(count(array<int, 4>{1, 2, 1, 2}, 1) == 2);
+
+            // predicates returning a Constant still give a Constant
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(array<int, 3>{1, 2, 3}, always(true_)),
+                size_t<3>
+            ));
+        }
+
         static_assert(models<Foldable, int[3]>, "");
     }
 
@@ -100,6 +145,18 @@ int main() {
             , "");
         }
 
+        // any_of on arrays spanning several blocks of lanes
+        {
+            int xs[100] = {};
+            BOOST_HANA_RUNTIME_CHECK(!any_of(xs, _ == 1));
+            for (int i : {0, 1, 31, 32, 63, 64, 95, 96, 99}) {
+                xs[i] = 1;
+                BOOST_HANA_RUNTIME_CHECK(any_of(xs, _ == 1));
+                BOOST_HANA_RUNTIME_CHECK(!all_of(xs, _ == 1));
+                xs[i] = 0;
+            }
+        }
+
         // find_if
         // Note: Because we need the predicate to return a Constant, this
         // is incredibly not powerful.
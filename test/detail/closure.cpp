@@ -8,6 +8,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <laws/base.hpp>
 
+#include <array>
 #include <type_traits>
 #include <utility>
 using namespace boost::hana;
@@ -34,6 +35,16 @@ int main() {
 
         // default-constructibility
         constexpr detail::closure<T, U, V> z3{}; (void)z3;
+
+        // brace elision
+        detail::closure<std::array<int, 1>> array{1}; (void)array;
+    }
+
+    // empty elements do not take any space
+    {
+        static_assert(sizeof(detail::closure<T, U, int>) == sizeof(int), "");
+        static_assert(sizeof(detail::closure<T, int, U>) == sizeof(int), "");
+        static_assert(std::is_empty<detail::closure<T, U, V>>{}, "");
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -75,6 +86,25 @@ int main() {
         >{}, "");
     }
 
+    // narrowing conversions are rejected
+    {
+        static_assert(!std::is_constructible<
+            detail::closure<int>, long long
+        >{}, "");
+
+        static_assert(!std::is_constructible<
+            detail::closure<T, char>, T, int
+        >{}, "");
+
+        static_assert(!std::is_constructible<
+            detail::closure<int>, double
+        >{}, "");
+
+        static_assert(std::is_constructible<
+            detail::closure<long long>, int
+        >{}, "");
+    }
+
     // get
     {
         {
@@ -6,6 +6,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/ext/std/array.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/tuple.hpp>
 
 #include <laws/base.hpp>
@@ -53,6 +54,39 @@ int main() {
     //////////////////////////////////////////////////////////////////////////
     test::TestFoldable<ext::std::Array>{int_arrays};
 
+    // sum, product, minimum, maximum and count_if, with enough elements to
+    // go through several blocks of lanes and a tail
+    {
+        std::array<long, 100> xs{};
+        for (int i = 0; i < 100; ++i)
+            xs[i] = (i * 37) % 101 - 50;
+
+        long expected_sum = 0, expected_min = xs[0], expected_max = xs[0];
+        for (long x : xs) {
+            expected_sum += x;
+            expected_min = x < expected_min ? x : expected_min;
+            expected_max = expected_max < x ? x : expected_max;
+        }
+
+        BOOST_HANA_RUNTIME_CHECK(sum(xs) == expected_sum);
+        BOOST_HANA_RUNTIME_CHECK(minimum(xs) == expected_min);
+        BOOST_HANA_RUNTIME_CHECK(maximum(xs) == expected_max);
+        BOOST_HANA_RUNTIME_CHECK(count(xs, xs[42]) == 1);
+        BOOST_HANA_RUNTIME_CHECK(count_if(xs, [](long x) {
+            return x < 0;
+        }) == 50);
+
+        BOOST_HANA_CONSTEXPR_CHECK(sum(array<1, 2, 3, 4>()) == 10);
+        BOOST_HANA_CONSTEXPR_CHECK(product(array<1, 2, 3, 4>()) == 24);
+        BOOST_HANA_CONSTEXPR_CHECK(minimum(array<3, 1, 4, 2>()) == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(maximum(array<3, 1, 4, 2>()) == 4);
+
+        // empty arrays use the default implementations
+        BOOST_HANA_CONSTANT_CHECK(equal(sum(array<>()), int_<0>));
+        BOOST_HANA_CONSTANT_CHECK(equal(product(array<>()), int_<1>));
+        BOOST_HANA_CONSTANT_CHECK(equal(count(array<>(), 0), size_t<0>));
+    }
+
 #elif BOOST_HANA_TEST_PART == 4
     //////////////////////////////////////////////////////////////////////////
     // Iterable
@@ -112,6 +146,18 @@ int main() {
         auto eq_keys = make<Tuple>(ct_eq<0>{});
 
         test::TestSearchable<ext::std::Array>{eq_arrays, eq_keys};
+
+        // any_of with a runtime predicate, on arrays spanning several
+        // blocks of lanes
+        std::array<int, 100> xs{};
+        BOOST_HANA_RUNTIME_CHECK(!any_of(xs, [](int x) { return x == 1; }));
+        for (int i : {0, 1, 31, 32, 63, 64, 95, 96, 99}) {
+            xs[i] = 1;
+            BOOST_HANA_RUNTIME_CHECK(any_of(xs, [](int x) { return x == 1; }));
+            xs[i] = 0;
+        }
+        BOOST_HANA_CONSTEXPR_CHECK(any_of(array<0, 1, 2>(), equal.to(2)));
+        BOOST_HANA_CONSTANT_CHECK(not_(any_of(array<>(), equal.to(2))));
     }
 #endif
 }
@@ -0,0 +1,195 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/hash.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+using namespace boost::hana;
+
+
+// Members covering all the bytes of the object
+struct Point {
+    int x;
+    int y;
+};
+
+// Members with padding between them
+struct Padded {
+    char c;
+    long l;
+};
+
+struct Person {
+    std::string name;
+    int age;
+};
+
+enum class Color : unsigned char { red, green };
+
+struct Pixel {
+    Point position;
+    Color color;
+    unsigned char alpha;
+    short depth;
+};
+
+#define MEMBER(NAME)                                                        \
+    make<Pair>(BOOST_HANA_STRING(#NAME), [](auto&& x) -> decltype(auto) {   \
+        return id(std::forward<decltype(x)>(x).NAME);                       \
+    })                                                                      \
+/**/
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Point> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(x), MEMBER(y)); }
+    };
+
+    template <>
+    struct members_impl<Padded> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(c), MEMBER(l)); }
+    };
+
+    template <>
+    struct members_impl<Person> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(name), MEMBER(age)); }
+    };
+
+    template <>
+    struct members_impl<Pixel> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply() {
+            return make<Tuple>(MEMBER(position), MEMBER(color),
+                               MEMBER(alpha), MEMBER(depth));
+        }
+    };
+}}
+
+// Creates an object on storage filled with the given byte, so that its
+// padding bytes (if any) are different from those of other objects.
+template <typename X>
+struct on_garbage {
+    typename std::aligned_storage<sizeof(X), alignof(X)>::type storage;
+    X* x;
+
+    on_garbage(unsigned char byte, X const& value) {
+        std::memset(&storage, byte, sizeof(storage));
+        x = new (&storage) X(value);
+    }
+    ~on_garbage() { x->~X(); }
+};
+
+template <typename X>
+void check_equal_hashes(X const& x, X const& y) {
+    on_garbage<X> a{0x00, x}, b{0xff, y};
+    BOOST_HANA_RUNTIME_CHECK(equal(*a.x, *b.x));
+    BOOST_HANA_RUNTIME_CHECK(
+        static_cast<std::size_t>(hash(*a.x)) ==
+        static_cast<std::size_t>(hash(*b.x))
+    );
+}
+
+template <typename X>
+void check_different_hashes(X const& x, X const& y) {
+    BOOST_HANA_RUNTIME_CHECK(
+        static_cast<std::size_t>(hash(x)) != static_cast<std::size_t>(hash(y))
+    );
+}
+
+int main() {
+    // Strings and Constants are hashed at compile-time
+    {
+        auto abc = BOOST_HANA_STRING("abc");
+        auto abd = BOOST_HANA_STRING("abd");
+        static_assert(_models<Constant, decltype(hash(abc))>{}, "");
+        BOOST_HANA_CONSTANT_CHECK(hash(abc) == hash(BOOST_HANA_STRING("abc")));
+        BOOST_HANA_CONSTANT_CHECK(hash(abc) != hash(abd));
+        BOOST_HANA_CONSTANT_CHECK(hash(BOOST_HANA_STRING("")) != hash(abc));
+
+        static_assert(_models<Constant, decltype(hash(int_<1>))>{}, "");
+        BOOST_HANA_CONSTANT_CHECK(hash(int_<1>) == hash(int_<1>));
+        BOOST_HANA_CONSTANT_CHECK(hash(int_<1>) != hash(int_<2>));
+        BOOST_HANA_CONSTANT_CHECK(hash(true_) != hash(false_));
+    }
+
+    // integral and enumeration values
+    {
+        check_equal_hashes(1, 1);
+        check_different_hashes(1, 2);
+        check_different_hashes(Color::red, Color::green);
+    }
+
+    // Records whose bytes are hashed at once
+    {
+        check_equal_hashes(Point{1, 2}, Point{1, 2});
+        check_different_hashes(Point{1, 2}, Point{2, 1});
+        check_different_hashes(Point{1, 2}, Point{1, 3});
+
+        check_equal_hashes(Pixel{{1, 2}, Color::red, 3, 4},
+                           Pixel{{1, 2}, Color::red, 3, 4});
+        check_different_hashes(Pixel{{1, 2}, Color::red, 3, 4},
+                               Pixel{{1, 2}, Color::green, 3, 4});
+    }
+
+    // Records whose members are hashed one by one
+    {
+        // padding bytes are not hashed
+        check_equal_hashes(Padded{'a', 1}, Padded{'a', 1});
+        check_different_hashes(Padded{'a', 1}, Padded{'b', 1});
+
+        check_equal_hashes(Person{"John", 30}, Person{"John", 30});
+        check_different_hashes(Person{"John", 30}, Person{"Bob", 30});
+        check_different_hashes(Person{"John", 30}, Person{"John", 31});
+    }
+
+    // Tuples and Pairs
+    {
+        check_equal_hashes(make<Tuple>(1, 2u, 'c'), make<Tuple>(1, 2u, 'c'));
+        check_different_hashes(make<Tuple>(1, 2), make<Tuple>(2, 1));
+
+        check_equal_hashes(make<Tuple>(std::string{"abc"}, 1.5, int_<1>),
+                           make<Tuple>(std::string{"abc"}, 1.5, int_<1>));
+        check_different_hashes(make<Tuple>(std::string{"abc"}, 1.5),
+                               make<Tuple>(std::string{"abd"}, 1.5));
+
+        check_equal_hashes(make<Pair>(1, 2), make<Pair>(1, 2));
+        check_different_hashes(make<Pair>(1, 2), make<Pair>(2, 1));
+        check_equal_hashes(make<Pair>(std::string{"abc"}, Point{1, 2}),
+                           make<Pair>(std::string{"abc"}, Point{1, 2}));
+    }
+
+    // usable as the hash function of unordered containers
+    {
+        using Hash = std::decay_t<decltype(hash)>;
+        using Equal = std::decay_t<decltype(equal)>;
+        std::unordered_map<Person, int, Hash, Equal> ids;
+        ids[Person{"John", 30}] = 1;
+        ids[Person{"Bob", 40}] = 2;
+        ids[Person{"John", 30}] = 3;
+        BOOST_HANA_RUNTIME_CHECK(ids.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(ids.at(Person{"John", 30}) == 3);
+        BOOST_HANA_RUNTIME_CHECK(ids.count(Person{"John", 31}) == 0);
+    }
+}
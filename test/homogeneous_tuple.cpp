@@ -0,0 +1,342 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/homogeneous_tuple.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/iterable.hpp>
+#include <laws/orderable.hpp>
+#include <laws/searchable.hpp>
+#include <test/numeric.hpp>
+
+#include <string>
+#include <utility>
+using namespace boost::hana;
+
+
+using test::numeric;
+using test::numeric_type;
+
+struct move_only {
+    int value;
+    explicit move_only(int v) : value(v) { }
+    move_only(move_only&&) = default;
+    move_only(move_only const&) = delete;
+};
+
+int main() {
+    //////////////////////////////////////////////////////////////////////////
+    // Setup for the laws below
+    //////////////////////////////////////////////////////////////////////////
+    auto empty = empty_homogeneous_tuple<numeric_type>;
+    auto tuples = make<Tuple>(
+          empty
+        , homogeneous_tuple(numeric(0))
+        , homogeneous_tuple(numeric(1))
+        , homogeneous_tuple(numeric(0), numeric(1))
+        , homogeneous_tuple(numeric(1), numeric(0))
+        , homogeneous_tuple(numeric(0), numeric(1), numeric(2))
+        , homogeneous_tuple(numeric(0), numeric(2), numeric(1))
+    );
+
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    {
+        constexpr auto xs = make<HomogeneousTuple>(1, 2, 3);
+        static_assert(detail::std::is_same<
+            decltype(xs), _homogeneous_tuple<int, 3> const
+        >{}, "");
+        static_assert(sizeof(xs) == 3 * sizeof(int), "");
+
+        int const i = 1;
+        int j = 2;
+        static_assert(detail::std::is_same<
+            decltype(homogeneous_tuple(i, j, 3)), _homogeneous_tuple<int, 3>
+        >{}, "");
+
+        auto ys = homogeneous_tuple(move_only{1}, move_only{2});
+        BOOST_HANA_RUNTIME_CHECK(head(ys).value == 1);
+        BOOST_HANA_RUNTIME_CHECK(last(ys).value == 2);
+
+        // empty homogeneous tuples, even of non default-constructible types
+        static_assert(detail::std::is_same<
+            decltype(empty_homogeneous_tuple<move_only>),
+            _homogeneous_tuple<move_only, 0> const
+        >{}, "");
+        BOOST_HANA_CONSTANT_CHECK(is_empty(empty_homogeneous_tuple<move_only>));
+        BOOST_HANA_CONSTANT_CHECK(
+            length(empty_homogeneous_tuple<int>) == size_t<0>
+        );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable and Orderable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTANT_CHECK(not_(equal(
+            homogeneous_tuple(1, 2), homogeneous_tuple(1, 2, 3)
+        )));
+        BOOST_HANA_CONSTEXPR_CHECK(equal(
+            homogeneous_tuple(1, 2, 3), homogeneous_tuple(1, 2, 3)
+        ));
+        BOOST_HANA_CONSTEXPR_CHECK(not_(equal(
+            homogeneous_tuple(1, 2, 3), homogeneous_tuple(1, 2, 4)
+        )));
+        BOOST_HANA_CONSTEXPR_CHECK(equal(
+            homogeneous_tuple(1, 2), homogeneous_tuple(1l, 2l)
+        ));
+
+        BOOST_HANA_CONSTEXPR_CHECK(less(
+            homogeneous_tuple(1, 2), homogeneous_tuple(1, 3)
+        ));
+        BOOST_HANA_CONSTEXPR_CHECK(less(
+            homogeneous_tuple(1, 2), homogeneous_tuple(1, 2, 0)
+        ));
+        BOOST_HANA_CONSTEXPR_CHECK(not_(less(
+            homogeneous_tuple(1, 2, 0), homogeneous_tuple(1, 2)
+        )));
+        BOOST_HANA_CONSTEXPR_CHECK(not_(less(
+            homogeneous_tuple(1, 2), homogeneous_tuple(1, 2)
+        )));
+
+        test::TestComparable<HomogeneousTuple>{tuples};
+        test::TestOrderable<HomogeneousTuple>{tuples};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // the function is called in order, and its results are stored in a
+        // homogeneous tuple of the result type
+        std::string calls;
+        auto ys = transform(homogeneous_tuple(1, 2, 3), [&](int i) {
+            calls += std::to_string(i);
+            return static_cast<long>(i * 10);
+        });
+        static_assert(detail::std::is_same<
+            decltype(ys), _homogeneous_tuple<long, 3>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(ys == homogeneous_tuple(10l, 20l, 30l));
+        BOOST_HANA_RUNTIME_CHECK(calls == "123");
+
+        BOOST_HANA_RUNTIME_CHECK(
+            fill(homogeneous_tuple(1, 2, 3), 'x') == homogeneous_tuple('x', 'x', 'x')
+        );
+
+        // elements of a temporary homogeneous tuple are moved
+        auto zs = transform(homogeneous_tuple(move_only{1}, move_only{2}),
+            [](move_only&& m) { return std::move(m); });
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(zs).value == 2);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // foldl and foldr call the function in the right order
+        {
+            auto append = [](std::string s, int i) { return s + std::to_string(i); };
+            auto prepend = [](int i, std::string s) { return s + std::to_string(i); };
+            BOOST_HANA_RUNTIME_CHECK(
+                foldl(homogeneous_tuple(1, 2, 3, 4), std::string{}, append) == "1234"
+            );
+            BOOST_HANA_RUNTIME_CHECK(
+                foldr(homogeneous_tuple(1, 2, 3, 4), std::string{}, prepend) == "4321"
+            );
+            BOOST_HANA_RUNTIME_CHECK(
+                foldl(empty, std::string{"x"}, append) == "x"
+            );
+        }
+
+        // the state may change type before the loop kicks in
+        {
+            auto f = [](auto state, int i) { return i + sizeof(state) * 0; };
+            auto result = foldl(homogeneous_tuple(1, 2, 3), type<void>, f);
+            static_assert(detail::std::is_same<
+                decltype(result), detail::std::size_t
+            >{}, "");
+            BOOST_HANA_RUNTIME_CHECK(result == 3);
+
+            auto g = [](int i, auto state) { return i + sizeof(state) * 0; };
+            BOOST_HANA_RUNTIME_CHECK(foldr(homogeneous_tuple(1, 2, 3), type<void>, g) == 1);
+        }
+
+        // foldl1 and foldr1
+        {
+            auto minus = [](int a, int b) { return a - b; };
+            BOOST_HANA_CONSTEXPR_CHECK(foldl1(homogeneous_tuple(10, 2, 3), minus) == 5);
+            BOOST_HANA_CONSTEXPR_CHECK(foldr1(homogeneous_tuple(10, 2, 3), minus) == 11);
+            BOOST_HANA_CONSTEXPR_CHECK(foldl1(homogeneous_tuple(10), minus) == 10);
+        }
+
+        // tree_fold groups the elements like the variadic tree_fold
+        {
+            auto f = [](std::string x, std::string y) {
+                return "f(" + x + ", " + y + ")";
+            };
+            BOOST_HANA_RUNTIME_CHECK(tree_fold(homogeneous_tuple(
+                std::string{"1"}, std::string{"2"}, std::string{"3"},
+                std::string{"4"}, std::string{"5"}
+            ), f) == "f(f(f(1, 2), f(3, 4)), 5)");
+            BOOST_HANA_RUNTIME_CHECK(tree_fold(homogeneous_tuple(
+                std::string{"1"}, std::string{"2"}, std::string{"3"}
+            ), f) == tree_fold(make<Tuple>(
+                std::string{"1"}, std::string{"2"}, std::string{"3"}
+            ), f));
+            BOOST_HANA_RUNTIME_CHECK(
+                tree_fold(homogeneous_tuple(std::string{"1"}), f) == "1"
+            );
+        }
+
+        // sum, product, minimum, maximum and count_if
+        {
+            BOOST_HANA_CONSTEXPR_CHECK(sum(homogeneous_tuple(1, 2, 3, 4)) == 10);
+            BOOST_HANA_CONSTEXPR_CHECK(product(homogeneous_tuple(1, 2, 3, 4)) == 24);
+            BOOST_HANA_CONSTEXPR_CHECK(minimum(homogeneous_tuple(3, 1, 4, 2)) == 1);
+            BOOST_HANA_CONSTEXPR_CHECK(maximum(homogeneous_tuple(3, 1, 4, 2)) == 4);
+
+            BOOST_HANA_RUNTIME_CHECK(count_if(homogeneous_tuple(1, 2, 3, 4), [](int i) {
+                return i % 2 == 0;
+            }) == 2);
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(homogeneous_tuple(1, 2, 3), always(true_)), size_t<3>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(homogeneous_tuple(1, 2, 3), always(false_)), size_t<0>
+            ));
+        }
+
+        // for_each and unpack
+        {
+            std::string visited;
+            for_each(homogeneous_tuple(1, 2, 3), [&](int i) {
+                visited += std::to_string(i);
+            });
+            BOOST_HANA_RUNTIME_CHECK(visited == "123");
+
+            BOOST_HANA_CONSTEXPR_CHECK(
+                unpack(homogeneous_tuple(1, 2, 3), make<Tuple>) == make<Tuple>(1, 2, 3)
+            );
+        }
+
+        test::TestFoldable<HomogeneousTuple>{tuples};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        constexpr auto xs = homogeneous_tuple(1, 2, 3, 4);
+        BOOST_HANA_CONSTEXPR_CHECK(head(xs) == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(at_c<2>(xs) == 3);
+        BOOST_HANA_CONSTEXPR_CHECK(last(xs) == 4);
+        BOOST_HANA_CONSTEXPR_CHECK(tail(xs) == homogeneous_tuple(2, 3, 4));
+        BOOST_HANA_CONSTEXPR_CHECK(drop(size_t<2>, xs) == homogeneous_tuple(3, 4));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(drop(size_t<10>, xs)));
+        BOOST_HANA_CONSTANT_CHECK(not_(is_empty(xs)));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(tail(homogeneous_tuple(1))));
+
+        // tail of a one-element tuple of a type which is not default
+        // constructible
+        auto ys = tail(homogeneous_tuple(move_only{1}));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(ys));
+
+        // subscript with a runtime index
+        auto zs = homogeneous_tuple(1, 2, 3, 4);
+        for (int i = 0; i != 4; ++i)
+            BOOST_HANA_RUNTIME_CHECK(zs[i] == i + 1);
+        zs[2] = 30;
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(zs) == 30);
+
+        test::TestIterable<HomogeneousTuple>{tuples};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = homogeneous_tuple(1, 2, 3);
+        BOOST_HANA_RUNTIME_CHECK(any_of(xs, [](int i) { return i == 2; }));
+        BOOST_HANA_RUNTIME_CHECK(!any_of(xs, [](int i) { return i == 4; }));
+        BOOST_HANA_RUNTIME_CHECK(all_of(xs, [](int i) { return i > 0; }));
+        BOOST_HANA_CONSTANT_CHECK(any_of(xs, always(true_)));
+        BOOST_HANA_CONSTANT_CHECK(not_(any_of(empty, always(true_))));
+
+        BOOST_HANA_RUNTIME_CHECK(find_if(xs, always(true_)) == just(1));
+        BOOST_HANA_CONSTANT_CHECK(find_if(xs, always(false_)) == nothing);
+        BOOST_HANA_CONSTANT_CHECK(find_if(empty, always(true_)) == nothing);
+
+        // find_if requires predicates returning a Constant, so we only use
+        // keys of a different type, which are never found
+        struct not_there { };
+        test::TestSearchable<HomogeneousTuple>{tuples, make<Tuple>(not_there{})};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Monoid, Group and Ring
+    //////////////////////////////////////////////////////////////////////////
+    {
+        constexpr auto xs = homogeneous_tuple(1, 2, 3, 4);
+        constexpr auto ys = homogeneous_tuple(10, 20, 30, 40);
+        BOOST_HANA_CONSTEXPR_CHECK(plus(xs, ys) == homogeneous_tuple(11, 22, 33, 44));
+        BOOST_HANA_CONSTEXPR_CHECK(minus(ys, xs) == homogeneous_tuple(9, 18, 27, 36));
+        BOOST_HANA_CONSTEXPR_CHECK(mult(xs, ys) == homogeneous_tuple(10, 40, 90, 160));
+        BOOST_HANA_CONSTEXPR_CHECK(negate(xs) == homogeneous_tuple(-1, -2, -3, -4));
+
+        // operators
+        BOOST_HANA_CONSTEXPR_CHECK(xs + ys == plus(xs, ys));
+        BOOST_HANA_CONSTEXPR_CHECK(ys - xs == minus(ys, xs));
+        BOOST_HANA_CONSTEXPR_CHECK(xs * ys == mult(xs, ys));
+        BOOST_HANA_CONSTEXPR_CHECK(-xs == negate(xs));
+
+        // the type of the elements follows the usual arithmetic conversions
+        auto zs = homogeneous_tuple(1.5f, 2.5f) * homogeneous_tuple(2.0, 2.0);
+        static_assert(detail::std::is_same<
+            decltype(zs), _homogeneous_tuple<double, 2>
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(zs == homogeneous_tuple(3.0, 5.0));
+
+        // non-arithmetic elements
+        BOOST_HANA_RUNTIME_CHECK(
+            homogeneous_tuple(numeric(1), numeric(2)) + homogeneous_tuple(numeric(3), numeric(4))
+                ==
+            homogeneous_tuple(numeric(4), numeric(6))
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            homogeneous_tuple(std::string{"a"}, std::string{"b"}) +
+            homogeneous_tuple(std::string{"c"}, std::string{"d"})
+                ==
+            homogeneous_tuple(std::string{"ac"}, std::string{"bd"})
+        );
+
+        // empty homogeneous tuples
+        BOOST_HANA_CONSTANT_CHECK(is_empty(plus(empty, empty)));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(negate(empty)));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Conversions
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTEXPR_CHECK(
+            to<Tuple>(homogeneous_tuple(1, 2, 3)) == make<Tuple>(1, 2, 3)
+        );
+        BOOST_HANA_CONSTEXPR_CHECK(
+            to<HomogeneousTuple>(make<Tuple>(1, 2, 3)) == homogeneous_tuple(1, 2, 3)
+        );
+    }
+}
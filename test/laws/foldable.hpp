@@ -250,6 +250,38 @@ namespace boost { namespace hana { namespace test {
                 f(f(f(z, x<2>{}), x<3>{}), x<4>{})
             ));
 
+            //////////////////////////////////////////////////////////////////
+            // tree_fold
+            //////////////////////////////////////////////////////////////////
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                tree_fold(list(z), f),
+                z
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                tree_fold(list(z, x<2>{}), f),
+                f(z, x<2>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                tree_fold(list(z, x<2>{}, x<3>{}), f),
+                f(f(z, x<2>{}), x<3>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                tree_fold(list(z, x<2>{}, x<3>{}, x<4>{}), f),
+                f(f(z, x<2>{}), f(x<3>{}, x<4>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                tree_fold(list(z, x<2>{}, x<3>{}, x<4>{}, x<5>{}), f),
+                f(f(f(z, x<2>{}), f(x<3>{}, x<4>{})), x<5>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                tree_fold(list(z, x<2>{}, x<3>{}, x<4>{}, x<5>{}, x<6>{}), f),
+                f(f(f(z, x<2>{}), f(x<3>{}, x<4>{})), f(x<5>{}, x<6>{}))
+            ));
+
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                tree_fold(list(1, 2, 3, 4, 5), plus), 1 + 2 + 3 + 4 + 5
+            ));
+
             //////////////////////////////////////////////////////////////////
             // foldr
             //////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/range.hpp>
 
 #include <laws/base.hpp>
@@ -51,6 +52,12 @@ namespace boost { namespace hana { namespace test {
                     ));
 
                     // methods
+                    // uncons(xs) == pair(head(xs), tail(xs)) unless xs is empty
+                    BOOST_HANA_CHECK(hana::equal(
+                        hana::uncons(xs_),
+                        hana::pair(hana::head(xs_), hana::tail(xs_))
+                    ));
+
                     // drop(1, xs) == tail(xs) unless xs is empty
                     BOOST_HANA_CHECK(hana::equal(
                         hana::drop(size_t<1>, xs_),
@@ -314,6 +321,27 @@ namespace boost { namespace hana { namespace test {
                 tail(list(1, '2', 3.3)), list('2', 3.3)
             ));
 
+            //////////////////////////////////////////////////////////////////
+            // uncons
+            //////////////////////////////////////////////////////////////////
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                uncons(list(x<0>{})), pair(x<0>{}, list())
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                uncons(list(x<0>{}, x<1>{})), pair(x<0>{}, list(x<1>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                uncons(list(x<0>{}, x<1>{}, x<2>{})),
+                pair(x<0>{}, list(x<1>{}, x<2>{}))
+            ));
+
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                uncons(list(1)), pair(1, list())
+            ));
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                uncons(list(1, '2', 3.3)), pair(1, list('2', 3.3))
+            ));
+
 
             //////////////////////////////////////////////////////////////////
             // at
@@ -55,6 +55,15 @@ namespace boost { namespace hana { namespace test {
                     hana::greater_equal(a, b) ^iff^ hana::not_(hana::less(a, b))
                 );
 
+                // compare
+                BOOST_HANA_CHECK(
+                    hana::less(a, b) ^iff^ hana::less(hana::compare(a, b), 0)
+                );
+
+                BOOST_HANA_CHECK(
+                    hana::less(b, a) ^iff^ hana::less(0, hana::compare(a, b))
+                );
+
                 // less.than & al.
                 BOOST_HANA_CHECK(less.than(a)(b) ^iff^ hana::less(b, a));
                 BOOST_HANA_CHECK(greater.than(a)(b) ^iff^ hana::greater(b, a));
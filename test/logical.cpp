@@ -11,6 +11,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <laws/logical.hpp>
 
+#include <type_traits>
 #include <vector>
 using namespace boost::hana;
 
@@ -79,4 +80,33 @@ int main() {
             std::vector<int>{0, 1, 2, 3}
         ));
     }
+
+    // while_ and until with a runtime condition do not recurse when the
+    // type of the state is stable
+    {
+        auto incr = [](long i) { return i + 1; };
+        BOOST_HANA_RUNTIME_CHECK(
+            while_([](long i) { return i < 10000000; }, 0l, incr) == 10000000
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            until([](long i) { return i == 10000000; }, 0l, incr) == 10000000
+        );
+
+        // The state becomes stable after its first update.
+        auto widen = [](auto i) { return i + 1l; };
+        auto r1 = while_([](auto i) { return i < 10000000; }, 0, widen);
+        static_assert(std::is_same<decltype(r1), long>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(r1 == 10000000);
+
+        auto r2 = until([](auto i) { return i == 10000000; }, 0, widen);
+        static_assert(std::is_same<decltype(r2), long>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(r2 == 10000000);
+
+        // lvalue states are not modified
+        long const start = 3;
+        BOOST_HANA_RUNTIME_CHECK(
+            while_([](long i) { return i < 10; }, start, incr) == 10
+        );
+        BOOST_HANA_RUNTIME_CHECK(start == 3);
+    }
 }
@@ -0,0 +1,122 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/map.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+using namespace boost::hana;
+
+
+template <typename Lookup>
+int lookup(Lookup const& table, char const* str) {
+    int result = -1;
+    bool found = table(str, [&](auto const& value) { result = value; });
+    BOOST_HANA_RUNTIME_CHECK(found == (result != -1));
+    return result;
+}
+
+template <typename Lookup>
+int lookup(Lookup const& table, char const* str, unsigned long length) {
+    int result = -1;
+    table(str, length, [&](auto const& value) { result = value; });
+    return result;
+}
+
+template <int i>
+struct handler {
+    int operator()() const { return i; }
+};
+
+int main() {
+    // empty map
+    {
+        auto table = frozen_lookup(make_map());
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "") == -1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abc") == -1);
+    }
+
+    // a single key
+    {
+        auto table = frozen_lookup(make_map(
+            pair(BOOST_HANA_STRING("abc"), 0)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abc") == 0);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "ab") == -1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abcd") == -1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "") == -1);
+    }
+
+    // the empty string as a key, and keys that are prefixes of each other
+    {
+        auto table = frozen_lookup(make_map(
+            pair(BOOST_HANA_STRING(""), 0),
+            pair(BOOST_HANA_STRING("a"), 1),
+            pair(BOOST_HANA_STRING("ab"), 2),
+            pair(BOOST_HANA_STRING("abc"), 3)
+        ));
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "") == 0);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "a") == 1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "ab") == 2);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abc") == 3);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abcd") == -1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "b") == -1);
+
+        // strings which are not null-terminated
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abcd", 0) == 0);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abcd", 2) == 2);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "abcd", 4) == -1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "xbcd", 3) == -1);
+    }
+
+    // many keys
+    {
+        auto table = frozen_lookup(make_map(
+            pair(BOOST_HANA_STRING("zero"), 0),
+            pair(BOOST_HANA_STRING("one"), 1),
+            pair(BOOST_HANA_STRING("two"), 2),
+            pair(BOOST_HANA_STRING("three"), 3),
+            pair(BOOST_HANA_STRING("four"), 4),
+            pair(BOOST_HANA_STRING("five"), 5),
+            pair(BOOST_HANA_STRING("six"), 6),
+            pair(BOOST_HANA_STRING("seven"), 7),
+            pair(BOOST_HANA_STRING("eight"), 8),
+            pair(BOOST_HANA_STRING("nine"), 9),
+            pair(BOOST_HANA_STRING("ten"), 10),
+            pair(BOOST_HANA_STRING("eleven"), 11),
+            pair(BOOST_HANA_STRING("twelve"), 12)
+        ));
+        char const* names[] = {
+            "zero", "one", "two", "three", "four", "five", "six",
+            "seven", "eight", "nine", "ten", "eleven", "twelve"
+        };
+        for (int i = 0; i != 13; ++i)
+            BOOST_HANA_RUNTIME_CHECK(lookup(table, names[i]) == i);
+
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "thirteen") == -1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "Zero") == -1);
+        BOOST_HANA_RUNTIME_CHECK(lookup(table, "zer") == -1);
+    }
+
+    // values of different types
+    {
+        auto table = frozen_lookup(make_map(
+            pair(BOOST_HANA_STRING("first"), handler<1>{}),
+            pair(BOOST_HANA_STRING("second"), handler<2>{}),
+            pair(BOOST_HANA_STRING("third"), handler<3>{})
+        ));
+        int result = 0;
+        auto call = [&](auto const& f) { result = f(); };
+
+        BOOST_HANA_RUNTIME_CHECK(table("second", call));
+        BOOST_HANA_RUNTIME_CHECK(result == 2);
+        BOOST_HANA_RUNTIME_CHECK(table("third", call));
+        BOOST_HANA_RUNTIME_CHECK(result == 3);
+        BOOST_HANA_RUNTIME_CHECK(!table("fourth", call));
+        BOOST_HANA_RUNTIME_CHECK(result == 3);
+    }
+}
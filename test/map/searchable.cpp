@@ -7,8 +7,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/map.hpp>
 
 #include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/maybe.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/searchable.hpp>
@@ -26,6 +29,8 @@ auto val = test::ct_eq<-i>{};
 template <int i, int j>
 auto p = test::minimal_product(key<i>, val<j>);
 
+struct x0; struct x1; struct x2;
+
 
 int main() {
     auto eq_maps = make<Tuple>(
@@ -96,6 +101,34 @@ int main() {
             ));
         }
 
+        // find and elem with keys found by their type
+        {
+            auto map = make<Map>(
+                test::minimal_product(type<x0>, val<0>),
+                test::minimal_product(BOOST_HANA_STRING("x1"), val<1>),
+                test::minimal_product(int_<2>, val<2>)
+            );
+
+            BOOST_HANA_CONSTANT_CHECK(equal(find(map, type<x0>), just(val<0>)));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find(map, BOOST_HANA_STRING("x1")),
+                just(val<1>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(find(map, int_<2>), just(val<2>)));
+            BOOST_HANA_CONSTANT_CHECK(equal(find(map, long_<2>), just(val<2>)));
+            BOOST_HANA_CONSTANT_CHECK(equal(find(map, type<x1>), nothing));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find(map, BOOST_HANA_STRING("x2")),
+                nothing
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(find(map, long_<3>), nothing));
+
+            BOOST_HANA_CONSTANT_CHECK(elem(map, type<x0>));
+            BOOST_HANA_CONSTANT_CHECK(elem(map, long_<2>));
+            BOOST_HANA_CONSTANT_CHECK(not_(elem(map, type<x2>)));
+            BOOST_HANA_CONSTANT_CHECK(not_(elem(map, long_<3>)));
+        }
+
         // laws
         test::TestSearchable<Map>{eq_maps, eq_keys};
     }
@@ -0,0 +1,168 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace boost::hana;
+
+
+// Counts the comparisons, to check that the elements are compared only
+// once and until the first difference.
+int comparisons = 0;
+
+struct counted {
+    int value;
+    friend bool operator<(counted x, counted y) {
+        ++comparisons;
+        return x.value < y.value;
+    }
+};
+
+struct Person {
+    std::string name;
+    int age;
+};
+
+struct Counted {
+    counted a;
+    counted b;
+};
+
+#define MEMBER(NAME)                                                        \
+    make<Pair>(BOOST_HANA_STRING(#NAME), [](auto&& x) -> decltype(auto) {   \
+        return id(std::forward<decltype(x)>(x).NAME);                       \
+    })                                                                      \
+/**/
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Person> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(name), MEMBER(age)); }
+    };
+
+    template <>
+    struct members_impl<Counted> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(a), MEMBER(b)); }
+    };
+}}
+
+int main() {
+    // default definition from `less`
+    {
+        BOOST_HANA_CONSTEXPR_CHECK(compare(1, 2) == -1);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(2, 2) == 0);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(3, 2) == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(1, 2l) == -1);
+
+        BOOST_HANA_CONSTANT_CHECK(compare(int_<1>, int_<2>) == int_<-1>);
+        BOOST_HANA_CONSTANT_CHECK(compare(int_<2>, int_<2>) == int_<0>);
+        BOOST_HANA_CONSTANT_CHECK(compare(int_<3>, int_<2>) == int_<1>);
+    }
+
+    // Tuples
+    {
+        BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(1, 2), make<Tuple>(1, 2)) == 0);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(1, 2), make<Tuple>(1, 3)) == -1);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(2, 0), make<Tuple>(1, 3)) == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(1), make<Tuple>(1, 0)) == -1);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(1, 0), make<Tuple>(1)) == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(compare(make<Tuple>(0, 9), make<Tuple>(1)) == -1);
+
+        BOOST_HANA_CONSTANT_CHECK(compare(make<Tuple>(), make<Tuple>()) == int_<0>);
+        BOOST_HANA_CONSTANT_CHECK(compare(make<Tuple>(), make<Tuple>(1)) == int_<-1>);
+        BOOST_HANA_CONSTANT_CHECK(compare(tuple_c<int, 1, 2>, tuple_c<int, 1, 3>) == int_<-1>);
+        BOOST_HANA_CONSTANT_CHECK(compare(tuple_c<int, 1, 2>, tuple_c<int, 1, 2>) == int_<0>);
+        BOOST_HANA_CONSTANT_CHECK(less(tuple_c<int, 1, 2>, tuple_c<int, 1, 2, 0>));
+
+        // some elements compare at compile-time and the others at runtime
+        BOOST_HANA_RUNTIME_CHECK(compare(make<Tuple>(int_<1>, 2), make<Tuple>(int_<1>, 3)) == -1);
+        BOOST_HANA_RUNTIME_CHECK(compare(make<Tuple>(int_<2>, 2), make<Tuple>(int_<1>, 3)) == 1);
+
+        // nested tuples
+        BOOST_HANA_CONSTEXPR_CHECK(compare(
+            make<Tuple>(make<Tuple>(1, 2), 3),
+            make<Tuple>(make<Tuple>(1, 2), 4)
+        ) == -1);
+    }
+
+    // the elements of Tuples are compared once, until the first difference
+    {
+        comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(less(
+            make<Tuple>(counted{0}, counted{1}, counted{2}),
+            make<Tuple>(counted{1}, counted{1}, counted{2})
+        ));
+        BOOST_HANA_RUNTIME_CHECK(comparisons == 1);
+
+        comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(!less(
+            make<Tuple>(counted{1}, counted{2}, counted{2}),
+            make<Tuple>(counted{1}, counted{1}, counted{2})
+        ));
+        BOOST_HANA_RUNTIME_CHECK(comparisons == 4);
+    }
+
+    // Strings
+    {
+        auto abc = BOOST_HANA_STRING("abc");
+        auto abd = BOOST_HANA_STRING("abd");
+        auto ab = BOOST_HANA_STRING("ab");
+        BOOST_HANA_CONSTANT_CHECK(compare(abc, abd) == int_<-1>);
+        BOOST_HANA_CONSTANT_CHECK(compare(abd, abc) == int_<1>);
+        BOOST_HANA_CONSTANT_CHECK(compare(abc, abc) == int_<0>);
+        BOOST_HANA_CONSTANT_CHECK(compare(ab, abc) == int_<-1>);
+        BOOST_HANA_CONSTANT_CHECK(compare(abc, ab) == int_<1>);
+        BOOST_HANA_CONSTANT_CHECK(compare(BOOST_HANA_STRING(""), ab) == int_<-1>);
+        BOOST_HANA_CONSTANT_CHECK(less(ab, abc));
+        BOOST_HANA_CONSTANT_CHECK(!less(abc, ab));
+    }
+
+    // Records
+    {
+        static_assert(_models<Orderable, Person>{}, "");
+        BOOST_HANA_RUNTIME_CHECK(compare(Person{"John", 30}, Person{"John", 30}) == 0);
+        BOOST_HANA_RUNTIME_CHECK(compare(Person{"Bob", 40}, Person{"John", 30}) == -1);
+        BOOST_HANA_RUNTIME_CHECK(compare(Person{"John", 31}, Person{"John", 30}) == 1);
+        BOOST_HANA_RUNTIME_CHECK(less(Person{"John", 30}, Person{"John", 31}));
+        BOOST_HANA_RUNTIME_CHECK(less_equal(Person{"John", 30}, Person{"John", 30}));
+        BOOST_HANA_RUNTIME_CHECK(greater(Person{"John", 30}, Person{"Bob", 30}));
+
+        comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(less(Counted{{0}, {5}}, Counted{{1}, {0}}));
+        BOOST_HANA_RUNTIME_CHECK(comparisons == 1);
+    }
+
+    // sorting
+    {
+        std::vector<_tuple<int, std::string>> xs{
+            make<Tuple>(2, std::string{"b"}),
+            make<Tuple>(1, std::string{"b"}),
+            make<Tuple>(2, std::string{"a"}),
+            make<Tuple>(1, std::string{"a"})
+        };
+        std::sort(xs.begin(), xs.end(), less);
+        BOOST_HANA_RUNTIME_CHECK(std::is_sorted(xs.begin(), xs.end(),
+            [](auto const& x, auto const& y) { return compare(x, y) < 0; }
+        ));
+        BOOST_HANA_RUNTIME_CHECK(equal(xs[0], make<Tuple>(1, std::string{"a"})));
+        BOOST_HANA_RUNTIME_CHECK(equal(xs[3], make<Tuple>(2, std::string{"b"})));
+    }
+}
@@ -0,0 +1,209 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/packed_tuple.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/applicative.hpp>
+#include <laws/base.hpp>
+#include <laws/comparable.hpp>
+#include <laws/foldable.hpp>
+#include <laws/functor.hpp>
+#include <laws/iterable.hpp>
+#include <laws/monad.hpp>
+#include <laws/monad_plus.hpp>
+#include <laws/orderable.hpp>
+#include <laws/searchable.hpp>
+#include <laws/sequence.hpp>
+#include <laws/traversable.hpp>
+
+#include <string>
+#include <utility>
+using namespace boost::hana;
+
+
+template <int i>
+using eq = test::ct_eq<i>;
+
+using test::ct_ord;
+
+struct move_only {
+    int value;
+    explicit move_only(int v) : value(v) { }
+    move_only(move_only&&) = default;
+    move_only(move_only const&) = delete;
+};
+
+struct empty1 { };
+struct empty2 { };
+
+template <typename T>
+char const* address(T const& x) { return reinterpret_cast<char const*>(&x); }
+
+int main() {
+    auto big_eq_tuples = make<Tuple>(
+          packed_tuple()
+        , packed_tuple(eq<0>{})
+        , packed_tuple(eq<0>{}, eq<1>{})
+        , packed_tuple(eq<0>{}, eq<1>{}, eq<2>{})
+        , packed_tuple(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}, eq<4>{})
+    );
+    (void)big_eq_tuples;
+
+    auto small_eq_tuples = make<Tuple>(
+          packed_tuple()
+        , packed_tuple(eq<0>{})
+        , packed_tuple(eq<0>{}, eq<1>{})
+        , packed_tuple(eq<0>{}, eq<1>{}, eq<2>{})
+    );
+    (void)small_eq_tuples;
+
+    auto ord_tuples = make<Tuple>(
+          packed_tuple()
+        , packed_tuple(ct_ord<0>{})
+        , packed_tuple(ct_ord<0>{}, ct_ord<1>{})
+        , packed_tuple(ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{})
+        , packed_tuple(ct_ord<0>{}, ct_ord<1>{}, ct_ord<2>{}, ct_ord<3>{}, ct_ord<4>{})
+    );
+    (void)ord_tuples;
+
+#if BOOST_HANA_TEST_PART == 1
+    //////////////////////////////////////////////////////////////////////////
+    // Layout
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // the elements are sorted by decreasing alignment
+        auto xs = packed_tuple('a', 1.5, 'b', 2.5, true);
+        static_assert(sizeof(xs) <= 2 * sizeof(double) + alignof(double), "");
+        static_assert(sizeof(xs) < sizeof(make<Tuple>('a', 1.5, 'b', 2.5, true)), "");
+        BOOST_HANA_RUNTIME_CHECK(address(at_c<3>(xs)) - address(at_c<1>(xs)) == sizeof(double));
+        BOOST_HANA_RUNTIME_CHECK(address(at_c<2>(xs)) - address(at_c<0>(xs)) == sizeof(char));
+        BOOST_HANA_RUNTIME_CHECK(address(at_c<4>(xs)) - address(at_c<2>(xs)) == sizeof(char));
+
+        // but the logical order is preserved
+        BOOST_HANA_RUNTIME_CHECK(at_c<0>(xs) == 'a');
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(xs) == 1.5);
+        BOOST_HANA_RUNTIME_CHECK(at_c<2>(xs) == 'b');
+        BOOST_HANA_RUNTIME_CHECK(at_c<3>(xs) == 2.5);
+        BOOST_HANA_RUNTIME_CHECK(at_c<4>(xs) == true);
+        BOOST_HANA_RUNTIME_CHECK(xs[size_t<3>] == 2.5);
+
+        std::string visited;
+        for_each(xs, [&](auto x) { visited += std::to_string(sizeof(x)); });
+        BOOST_HANA_RUNTIME_CHECK(visited == std::to_string(sizeof(char)) +
+                                            std::to_string(sizeof(double)) +
+                                            std::to_string(sizeof(char)) +
+                                            std::to_string(sizeof(double)) +
+                                            std::to_string(sizeof(bool)));
+
+        BOOST_HANA_RUNTIME_CHECK(unpack(xs, [](char a, double b, char c, double d, bool e) {
+            return a == 'a' && b == 1.5 && c == 'b' && d == 2.5 && e;
+        }));
+
+        // empty elements take no space
+        static_assert(sizeof(packed_tuple(empty1{}, 'x', empty2{})) == sizeof(char), "");
+
+        // elements with the same alignment keep their relative order
+        auto ys = packed_tuple(1, 2, 3);
+        BOOST_HANA_RUNTIME_CHECK(address(at_c<0>(ys)) < address(at_c<1>(ys)));
+        BOOST_HANA_RUNTIME_CHECK(address(at_c<1>(ys)) < address(at_c<2>(ys)));
+
+        // constexpr-friendliness
+        constexpr auto zs = packed_tuple('a', 1.5, 2);
+        static_assert(at_c<0>(zs) == 'a' && at_c<1>(zs) == 1.5 && at_c<2>(zs) == 2, "");
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Move-only friendliness and conversions
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto xs = packed_tuple('x', move_only{1}, 2.5);
+        auto ys = std::move(xs);
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(ys).value == 1);
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(tail(std::move(ys))) == 2.5);
+
+        BOOST_HANA_RUNTIME_CHECK(
+            to<Tuple>(packed_tuple('a', 1.5, true)) == make<Tuple>('a', 1.5, true)
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            to<PackedTuple>(make<Tuple>('a', 1.5, true)) == packed_tuple('a', 1.5, true)
+        );
+    }
+
+#elif BOOST_HANA_TEST_PART == 2
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto eq_tuple_keys = make<Tuple>(eq<3>{}, eq<5>{}, eq<7>{});
+        test::TestSearchable<PackedTuple>{small_eq_tuples, eq_tuple_keys};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable and Orderable
+    //////////////////////////////////////////////////////////////////////////
+    test::TestComparable<PackedTuple>{big_eq_tuples};
+    test::TestOrderable<PackedTuple>{ord_tuples};
+
+#elif BOOST_HANA_TEST_PART == 3
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    test::TestMonadPlus<PackedTuple>{small_eq_tuples};
+
+#elif BOOST_HANA_TEST_PART == 4
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable, Iterable, Traversable
+    //////////////////////////////////////////////////////////////////////////
+    test::TestFoldable<PackedTuple>{big_eq_tuples};
+    test::TestIterable<PackedTuple>{big_eq_tuples};
+    test::TestTraversable<PackedTuple>{};
+
+#elif BOOST_HANA_TEST_PART == 5
+    //////////////////////////////////////////////////////////////////////////
+    // Functor up to Monad
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto eq_values = make<Tuple>(eq<0>{}, eq<2>{});
+
+        auto eq_tuples_tuples = make<Tuple>(
+              packed_tuple()
+            , packed_tuple(
+                packed_tuple(eq<0>{}))
+            , packed_tuple(
+                packed_tuple(eq<0>{}),
+                packed_tuple(eq<1>{}, eq<2>{}))
+            , packed_tuple(
+                packed_tuple(eq<0>{}),
+                packed_tuple(eq<1>{}, eq<2>{}),
+                packed_tuple(eq<3>{}, eq<4>{}))
+        );
+
+        test::TestFunctor<PackedTuple>{big_eq_tuples, eq_values};
+        test::TestApplicative<PackedTuple>{};
+        test::TestMonad<PackedTuple>{big_eq_tuples, eq_tuples_tuples};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+#elif BOOST_HANA_TEST_PART == 6
+#   define BOOST_HANA_TEST_SEQUENCE_KNOWN_PARTS 3
+#   define BOOST_HANA_TEST_SEQUENCE_PART 1
+    test::TestSequence<PackedTuple>{};
+#elif BOOST_HANA_TEST_PART == 7
+#   define BOOST_HANA_TEST_SEQUENCE_KNOWN_PARTS 3
+#   define BOOST_HANA_TEST_SEQUENCE_PART 2
+    test::TestSequence<PackedTuple>{};
+#elif BOOST_HANA_TEST_PART == 8
+#   define BOOST_HANA_TEST_SEQUENCE_KNOWN_PARTS 3
+#   define BOOST_HANA_TEST_SEQUENCE_PART 3
+    test::TestSequence<PackedTuple>{};
+#endif
+}
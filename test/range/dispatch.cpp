@@ -0,0 +1,110 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+using namespace boost::hana;
+
+
+int main() {
+    // dispatch with a single range
+    {
+        int visited = -100;
+        auto f = [&](auto x) { visited = value(x); };
+
+        for (int i = -3; i != 5; ++i) {
+            BOOST_HANA_RUNTIME_CHECK(dispatch(range_c<int, -3, 5>, i, f));
+            BOOST_HANA_RUNTIME_CHECK(visited == i);
+        }
+
+        visited = -100;
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<int, -3, 5>, -4, f));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<int, -3, 5>, 5, f));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<int, -3, 5>, 1000, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == -100);
+
+        // the value is converted to the type of the range
+        BOOST_HANA_RUNTIME_CHECK(dispatch(range_c<unsigned, 0, 4>, 3L, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == 3);
+
+        // the value is not narrowed before it is looked up
+        visited = -100;
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<unsigned char, 0, 4>, 257, f));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<signed char, -2, 2>, 255, f));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<unsigned, 0, 4>, -1, f));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<int, -2, 2>, 4294967295u, f));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<long long, 0, 4>, -1, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == -100);
+        BOOST_HANA_RUNTIME_CHECK(dispatch(range_c<unsigned char, 0, 4>, 3LL, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == 3);
+        BOOST_HANA_RUNTIME_CHECK(dispatch(range_c<int, -2, 2>, 1u, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == 1);
+    }
+
+    // dispatch with an empty range
+    {
+        auto f = [](auto) { BOOST_HANA_RUNTIME_CHECK(false); };
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(range_c<int, 0, 0>, 0, f));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(
+            make<Tuple>(range_c<int, 0, 3>, range_c<int, 2, 2>),
+            make<Tuple>(1, 2),
+            [](auto, auto) { BOOST_HANA_RUNTIME_CHECK(false); }
+        ));
+    }
+
+    // dispatch with several ranges
+    {
+        int visited = 0;
+        auto f2 = [&](auto x, auto y) {
+            visited = value(x) * 10 + value(y);
+        };
+        for (int i = 1; i != 4; ++i) {
+            for (int j = 0; j != 5; ++j) {
+                BOOST_HANA_RUNTIME_CHECK(dispatch(
+                    make<Tuple>(range_c<int, 1, 4>, range_c<int, 0, 5>),
+                    make<Tuple>(i, j),
+                    f2
+                ));
+                BOOST_HANA_RUNTIME_CHECK(visited == i * 10 + j);
+            }
+        }
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(
+            make<Tuple>(range_c<int, 1, 4>, range_c<int, 0, 5>),
+            make<Tuple>(0, 0),
+            f2
+        ));
+        BOOST_HANA_RUNTIME_CHECK(!dispatch(
+            make<Tuple>(range_c<int, 1, 4>, range_c<int, 0, 5>),
+            make<Tuple>(1, 5),
+            f2
+        ));
+
+        auto f3 = [&](auto x, auto y, auto z) {
+            visited = value(x) * 100 + value(y) * 10 + value(z);
+        };
+        BOOST_HANA_RUNTIME_CHECK(dispatch(
+            make<Tuple>(range_c<int, 0, 3>, range_c<int, 0, 2>,
+                        range_c<long, 5, 9>),
+            make<Tuple>(2, 1, 7L),
+            f3
+        ));
+        BOOST_HANA_RUNTIME_CHECK(visited == 217);
+
+        auto f4 = [&](auto x, auto y, auto z, auto w) {
+            visited = value(x) * 1000 + value(y) * 100 +
+                      value(z) * 10 + value(w);
+        };
+        BOOST_HANA_RUNTIME_CHECK(dispatch(
+            make<Tuple>(range_c<int, 0, 2>, range_c<int, 0, 3>,
+                        range_c<int, 0, 4>, range_c<int, 0, 5>),
+            make<Tuple>(1, 2, 3, 4),
+            f4
+        ));
+        BOOST_HANA_RUNTIME_CHECK(visited == 1234);
+    }
+}
@@ -0,0 +1,139 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+
+
+// Counts the comparisons, to check that they stop at the first difference.
+int comparisons = 0;
+
+struct counted {
+    int value;
+    friend bool operator==(counted x, counted y) {
+        ++comparisons;
+        return x.value == y.value;
+    }
+    friend bool operator!=(counted x, counted y) { return !(x == y); }
+};
+
+// Members covering all the bytes of the object
+struct Point {
+    int x;
+    int y;
+    int z;
+};
+
+struct Counted {
+    counted a;
+    counted b;
+    counted c;
+};
+
+struct Mixed {
+    int i;
+    _integral_constant<int, 1> one;
+};
+
+#define MEMBER(NAME)                                                        \
+    make<Pair>(BOOST_HANA_STRING(#NAME), [](auto&& x) -> decltype(auto) {   \
+        return id(std::forward<decltype(x)>(x).NAME);                       \
+    })                                                                      \
+/**/
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Point> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(x), MEMBER(y), MEMBER(z)); }
+    };
+
+    template <>
+    struct members_impl<Counted> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(a), MEMBER(b), MEMBER(c)); }
+    };
+
+    template <>
+    struct members_impl<Mixed> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(i), MEMBER(one)); }
+    };
+}}
+
+int main() {
+    // records of integers
+    {
+        static_assert(std::is_same<
+            decltype(equal(Point{1, 2, 3}, Point{1, 2, 3})), bool
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(equal(Point{1, 2, 3}, Point{1, 2, 3}));
+        BOOST_HANA_RUNTIME_CHECK(!equal(Point{0, 2, 3}, Point{1, 2, 3}));
+        BOOST_HANA_RUNTIME_CHECK(!equal(Point{1, 2, 3}, Point{1, 0, 3}));
+        BOOST_HANA_RUNTIME_CHECK(!equal(Point{1, 2, 3}, Point{1, 2, 0}));
+    }
+
+    // the comparisons stop at the first difference
+    {
+        comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(equal(Counted{{1}, {2}, {3}}, Counted{{1}, {2}, {3}}));
+        BOOST_HANA_RUNTIME_CHECK(comparisons == 3);
+
+        comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(!equal(Counted{{1}, {2}, {3}}, Counted{{1}, {0}, {3}}));
+        BOOST_HANA_RUNTIME_CHECK(comparisons == 2);
+
+        comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(!equal(Counted{{0}, {2}, {3}}, Counted{{1}, {2}, {3}}));
+        BOOST_HANA_RUNTIME_CHECK(comparisons == 1);
+    }
+
+    // members comparing to Constants
+    {
+        BOOST_HANA_RUNTIME_CHECK(equal(Mixed{1, {}}, Mixed{1, {}}));
+        BOOST_HANA_RUNTIME_CHECK(!equal(Mixed{1, {}}, Mixed{2, {}}));
+    }
+
+    // tuples of integers
+    {
+        static_assert(std::is_same<
+            decltype(equal(make<Tuple>(1, 2), make<Tuple>(1, 2))), bool
+        >{}, "");
+        BOOST_HANA_CONSTEXPR_CHECK(equal(make<Tuple>(1, 2, 3), make<Tuple>(1, 2, 3)));
+        BOOST_HANA_CONSTEXPR_CHECK(!equal(make<Tuple>(1, 2, 3), make<Tuple>(1, 0, 3)));
+        BOOST_HANA_CONSTEXPR_CHECK(equal(make<Tuple>(1, 2l), make<Tuple>(1l, 2)));
+        BOOST_HANA_CONSTANT_CHECK(!equal(make<Tuple>(1, 2), make<Tuple>(1)));
+        BOOST_HANA_CONSTANT_CHECK(equal(make<Tuple>(), make<Tuple>()));
+    }
+
+    // tuples whose comparisons stop at the first difference
+    {
+        comparisons = 0;
+        BOOST_HANA_RUNTIME_CHECK(!equal(
+            make<Tuple>(counted{0}, counted{1}, counted{2}),
+            make<Tuple>(counted{1}, counted{1}, counted{2})
+        ));
+        BOOST_HANA_RUNTIME_CHECK(comparisons == 1);
+    }
+
+    // tuples whose elements compare to Constants
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(make<Tuple>(int_<1>), make<Tuple>(int_<1>)));
+        BOOST_HANA_CONSTANT_CHECK(!equal(make<Tuple>(int_<1>), make<Tuple>(int_<2>)));
+        BOOST_HANA_RUNTIME_CHECK(equal(make<Tuple>(1, int_<1>), make<Tuple>(1, int_<1>)));
+    }
+}
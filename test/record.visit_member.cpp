@@ -0,0 +1,132 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/record_macros.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+
+
+struct moveonly {
+    int value;
+    moveonly() = default;
+    explicit moveonly(int v) : value(v) { }
+    moveonly(moveonly&&) = default;
+    moveonly(moveonly const&) = delete;
+};
+
+int value_of(moveonly m) { return m.value; }
+
+template <typename T>
+int value_of(T const&) { return -1; }
+
+struct Struct {
+    BOOST_HANA_DEFINE_RECORD_INTRUSIVE(Struct,
+        (int, x),
+        (std::string, name),
+        (std::string, name_),
+        (moveonly, m)
+    );
+};
+
+struct Empty { };
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Empty> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(); }
+    };
+}}
+
+// Minimal string-like object, to check that only `data()` and `size()`
+// are required.
+struct string_ref {
+    char const* data_;
+    unsigned size_;
+    char const* data() const { return data_; }
+    unsigned size() const { return size_; }
+};
+
+int main() {
+    // the members of an lvalue are passed by reference
+    {
+        Struct r{1, "abc", "def", moveonly{2}};
+        void const* address = nullptr;
+        BOOST_HANA_RUNTIME_CHECK(visit_member(r, "x", [&](auto& member) {
+            address = &member;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(address == &r.x);
+
+        BOOST_HANA_RUNTIME_CHECK(visit_member(r, "name_", [&](auto& member) {
+            address = &member;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(address == &r.name_);
+
+        // const records give const references
+        Struct const& cr = r;
+        visit_member(cr, "name", [](auto& member) {
+            static_assert(std::is_const<
+                std::remove_reference_t<decltype(member)>
+            >{}, "");
+        });
+    }
+
+    // the members of an rvalue can be moved from
+    {
+        int value = 0;
+        BOOST_HANA_RUNTIME_CHECK(
+            visit_member(Struct{1, "abc", "def", moveonly{2}}, "m", [&](auto&& member) {
+                value = value_of(std::move(member));
+            })
+        );
+        BOOST_HANA_RUNTIME_CHECK(value == 2);
+    }
+
+    // names which are not members
+    {
+        Struct r{1, "abc", "def", moveonly{2}};
+        int calls = 0;
+        auto count = [&](auto const&) { ++calls; };
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(r, "", count));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(r, "y", count));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(r, "nam", count));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(r, "name__", count));
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(r, "NAME", count));
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+
+        Empty e;
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(e, "x", count));
+        BOOST_HANA_RUNTIME_CHECK(calls == 0);
+    }
+
+    // the different ways of giving the name
+    {
+        Struct r{1, "abc", "def", moveonly{2}};
+        void const* address = nullptr;
+        auto get_address = [&](auto const& member) { address = &member; };
+
+        BOOST_HANA_RUNTIME_CHECK(visit_member(r, "name", get_address));
+        BOOST_HANA_RUNTIME_CHECK(address == &r.name);
+
+        BOOST_HANA_RUNTIME_CHECK(visit_member(r, "name_xyz", 5, get_address));
+        BOOST_HANA_RUNTIME_CHECK(address == &r.name_);
+
+        BOOST_HANA_RUNTIME_CHECK(visit_member(r, std::string{"x"}, get_address));
+        BOOST_HANA_RUNTIME_CHECK(address == &r.x);
+
+        BOOST_HANA_RUNTIME_CHECK(visit_member(r, string_ref{"mxyz", 1}, get_address));
+        BOOST_HANA_RUNTIME_CHECK(address == &r.m);
+
+        BOOST_HANA_RUNTIME_CHECK(!visit_member(r, std::string{}, get_address));
+    }
+}
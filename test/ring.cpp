@@ -5,6 +5,7 @@ Distributed under the Boost Software License, Version 1.0.
  */
 
 #include <boost/hana/assert.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/ring.hpp>
 #include <boost/hana/tuple.hpp>
 
@@ -21,4 +22,30 @@ int main() {
 
     // mult
     static_assert(mult(6, 4) == 6 * 4, "");
+
+    // power
+    {
+        // with a Constant exponent
+        static_assert(power(2, int_<0>) == 1, "");
+        static_assert(power(2, int_<1>) == 2, "");
+        static_assert(power(2, int_<10>) == 1024, "");
+        static_assert(power(3, int_<13>) == 1594323, "");
+        static_assert(power(2ull, int_<60>) == 1ull << 60, "");
+        BOOST_HANA_CONSTANT_CHECK(power(llong<2>, int_<60>) == llong<1ll << 60>);
+        BOOST_HANA_CONSTANT_CHECK(power(ullong<1>, size_t<1000>) == ullong<1>);
+
+        // with a runtime exponent
+        static_assert(power(2, 0) == 1, "");
+        static_assert(power(2, 1) == 2, "");
+        static_assert(power(2, 10) == 1024, "");
+        static_assert(power(3, 13) == 1594323, "");
+        static_assert(power(2ull, 60) == 1ull << 60, "");
+        for (int n = 0; n != 20; ++n) {
+            long expected = 1;
+            for (int i = 0; i != n; ++i)
+                expected *= 3;
+            BOOST_HANA_RUNTIME_CHECK(power(3l, n) == expected);
+            BOOST_HANA_RUNTIME_CHECK(power(3l, static_cast<unsigned>(n)) == expected);
+        }
+    }
 }
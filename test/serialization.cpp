@@ -0,0 +1,301 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/serialization.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/config.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/record.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+using namespace boost::hana;
+
+
+// Members without padding between them
+struct Point {
+    int x;
+    int y;
+    float z;
+};
+
+// Members with padding between them
+struct Padded {
+    char c;
+    double d;
+    short s;
+};
+
+// Members whose representation is empty
+struct Empty {
+    _integral_constant<int, 1> one;
+    _integral_constant<int, 2> two;
+};
+
+struct Message {
+    Point origin;
+    _tuple<int, double, char> header;
+    std::vector<int> values;
+    std::vector<Point> points;
+    std::vector<bool> flags;
+    _integral_constant<int, 3> version;
+    long sequence;
+};
+
+#define MEMBER(NAME)                                                        \
+    make<Pair>(BOOST_HANA_STRING(#NAME), [](auto&& x) -> decltype(auto) {   \
+        return id(std::forward<decltype(x)>(x).NAME);                       \
+    })                                                                      \
+/**/
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Point> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(x), MEMBER(y), MEMBER(z)); }
+    };
+
+    template <>
+    struct members_impl<Padded> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(c), MEMBER(d), MEMBER(s)); }
+    };
+
+    template <>
+    struct members_impl<Empty> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply()
+        { return make<Tuple>(MEMBER(one), MEMBER(two)); }
+    };
+
+    template <>
+    struct members_impl<Message> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply() {
+            return make<Tuple>(MEMBER(origin), MEMBER(header), MEMBER(values),
+                               MEMBER(points), MEMBER(flags), MEMBER(version),
+                               MEMBER(sequence));
+        }
+    };
+}}
+
+template <typename X>
+std::vector<char> serialize_to_vector(X const& x) {
+    std::vector<char> buffer(serialized_size(x));
+    char* last = serialize(x, buffer.data());
+    BOOST_HANA_RUNTIME_CHECK(last == buffer.data() + buffer.size());
+    return buffer;
+}
+
+template <typename X>
+X deserialize_from(std::vector<char> const& buffer) {
+    return deserialize<X>(buffer.data(), buffer.data() + buffer.size());
+}
+
+// Returns whether deserializing X from the first `size` bytes of `buffer`
+// throws `std::out_of_range`.
+template <typename X>
+bool truncated(std::vector<char> const& buffer, std::size_t size) {
+    try {
+        deserialize<X>(buffer.data(), buffer.data() + size);
+    } catch (std::out_of_range const&) {
+        return true;
+    }
+    return false;
+}
+
+template <typename X>
+std::vector<char> bytes_of(X const& x) {
+    char const* p = reinterpret_cast<char const*>(&x);
+    return std::vector<char>(p, p + sizeof(x));
+}
+
+template <typename ...X>
+std::vector<char> concat(X const& ...x) {
+    std::vector<char> result;
+    using swallow = int[];
+    (void)swallow{1, (result.insert(result.end(), x.begin(), x.end()), 1)...};
+    return result;
+}
+
+int main() {
+    // trivially copyable objects
+    {
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(1) == sizeof(int));
+        BOOST_HANA_RUNTIME_CHECK(serialize_to_vector(1) == bytes_of(1));
+        BOOST_HANA_RUNTIME_CHECK(deserialize_from<int>(serialize_to_vector(1)) == 1);
+        BOOST_HANA_RUNTIME_CHECK(deserialize_from<double>(serialize_to_vector(2.5)) == 2.5);
+    }
+
+    // empty objects are not written
+    {
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(int_<1>) == 0);
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(BOOST_HANA_STRING("abc")) == 0);
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(make<Tuple>()) == 0);
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(make<Tuple>(int_<1>, int_<2>)) == 0);
+    }
+
+    // Records are written member by member, without padding
+    {
+        Point p{1, 2, 3.5f};
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(p) == 2 * sizeof(int) + sizeof(float));
+        BOOST_HANA_RUNTIME_CHECK(serialize_to_vector(p) ==
+            concat(bytes_of(p.x), bytes_of(p.y), bytes_of(p.z)));
+        BOOST_HANA_RUNTIME_CHECK(equal(deserialize_from<Point>(serialize_to_vector(p)), p));
+
+        Padded q{'a', 1.5, 3};
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(q) ==
+            sizeof(char) + sizeof(double) + sizeof(short));
+        BOOST_HANA_RUNTIME_CHECK(serialize_to_vector(q) ==
+            concat(bytes_of(q.c), bytes_of(q.d), bytes_of(q.s)));
+        BOOST_HANA_RUNTIME_CHECK(equal(deserialize_from<Padded>(serialize_to_vector(q)), q));
+    }
+
+    // Tuples are written element by element
+    {
+        auto xs = make<Tuple>('a', 1.5, int_<3>, 4);
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(xs) ==
+            sizeof(char) + sizeof(double) + sizeof(int));
+        BOOST_HANA_RUNTIME_CHECK(serialize_to_vector(xs) ==
+            concat(bytes_of('a'), bytes_of(1.5), bytes_of(4)));
+        BOOST_HANA_RUNTIME_CHECK(
+            deserialize_from<decltype(xs)>(serialize_to_vector(xs)) == xs
+        );
+    }
+
+    // std::vectors are written as their size followed by their elements
+    {
+        std::vector<int> v{1, 2, 3};
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(v) ==
+            sizeof(unsigned long long) + 3 * sizeof(int));
+        BOOST_HANA_RUNTIME_CHECK(serialize_to_vector(v) ==
+            concat(bytes_of(3ull), bytes_of(1), bytes_of(2), bytes_of(3)));
+        BOOST_HANA_RUNTIME_CHECK(deserialize_from<std::vector<int>>(serialize_to_vector(v)) == v);
+
+        std::vector<Padded> w{{'a', 1.5, 3}, {'b', 2.5, 4}};
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(w) ==
+            sizeof(unsigned long long) + 2 * serialized_size(w[0]));
+        BOOST_HANA_RUNTIME_CHECK(equal(
+            deserialize_from<std::vector<Padded>>(serialize_to_vector(w)), w
+        ));
+
+        std::vector<bool> b{true, false, true};
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(b) == sizeof(unsigned long long) + 3);
+        BOOST_HANA_RUNTIME_CHECK(deserialize_from<std::vector<bool>>(serialize_to_vector(b)) == b);
+
+        std::vector<double> e;
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(e) == sizeof(unsigned long long));
+        BOOST_HANA_RUNTIME_CHECK(deserialize_from<std::vector<double>>(serialize_to_vector(e)).empty());
+    }
+
+    // nested Records, Tuples and std::vectors
+    {
+        Message m{
+            Point{1, 2, 3.5f},
+            make<Tuple>(4, 5.5, 'c'),
+            {6, 7, 8},
+            {Point{9, 10, 11.5f}, Point{12, 13, 14.5f}},
+            {true, false},
+            {},
+            15
+        };
+
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(m) ==
+            serialized_size(m.origin) + serialized_size(m.header) +
+            serialized_size(m.values) + serialized_size(m.points) +
+            serialized_size(m.flags) + sizeof(long));
+
+        std::vector<char> buffer = serialize_to_vector(m);
+        BOOST_HANA_RUNTIME_CHECK(buffer == concat(
+            serialize_to_vector(m.origin), serialize_to_vector(m.header),
+            serialize_to_vector(m.values), serialize_to_vector(m.points),
+            serialize_to_vector(m.flags), bytes_of(m.sequence)
+        ));
+
+        Message n = deserialize_from<Message>(buffer);
+        BOOST_HANA_RUNTIME_CHECK(equal(n, m));
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(n) == buffer.size());
+    }
+
+    // objects can be read one after the other
+    {
+        Point p{1, 2, 3.5f};
+        std::vector<int> v{4, 5};
+        std::vector<char> buffer(serialized_size(p) + serialized_size(v));
+        serialize(v, serialize(p, buffer.data()));
+
+        char const* in = buffer.data();
+        char const* last = buffer.data() + buffer.size();
+        Point q = deserialize<Point>(in, last);
+        in += serialized_size(q);
+        std::vector<int> w = deserialize<std::vector<int>>(in, last);
+        BOOST_HANA_RUNTIME_CHECK(equal(p, q));
+        BOOST_HANA_RUNTIME_CHECK(v == w);
+    }
+
+    // bytes past the end of the input are never read
+    {
+        Point p{1, 2, 3.5f};
+        std::vector<char> buffer = serialize_to_vector(p);
+        for (std::size_t size = 0; size < buffer.size(); ++size)
+            BOOST_HANA_RUNTIME_CHECK(truncated<Point>(buffer, size));
+        BOOST_HANA_RUNTIME_CHECK(!truncated<Point>(buffer, buffer.size()));
+
+        Message m{
+            Point{1, 2, 3.5f},
+            make<Tuple>(4, 5.5, 'c'),
+            {6, 7, 8},
+            {Point{9, 10, 11.5f}},
+            {true, false},
+            {},
+            15
+        };
+        buffer = serialize_to_vector(m);
+        for (std::size_t size = 0; size < buffer.size(); ++size)
+            BOOST_HANA_RUNTIME_CHECK(truncated<Message>(buffer, size));
+        BOOST_HANA_RUNTIME_CHECK(!truncated<Message>(buffer, buffer.size()));
+    }
+
+    // the size of a std::vector is checked before allocating its elements
+    {
+        std::vector<char> huge = concat(bytes_of(~0ull), bytes_of(1), bytes_of(2));
+        BOOST_HANA_RUNTIME_CHECK(truncated<std::vector<int>>(huge, huge.size()));
+        BOOST_HANA_RUNTIME_CHECK(truncated<std::vector<bool>>(huge, huge.size()));
+        BOOST_HANA_RUNTIME_CHECK(truncated<std::vector<Padded>>(huge, huge.size()));
+        BOOST_HANA_RUNTIME_CHECK(truncated<std::vector<std::vector<int>>>(huge, huge.size()));
+
+        std::vector<char> overflow = concat(
+            bytes_of(~0ull / sizeof(int) + 2), bytes_of(1), bytes_of(2)
+        );
+        BOOST_HANA_RUNTIME_CHECK(truncated<std::vector<int>>(overflow, overflow.size()));
+    }
+
+    // std::vectors whose elements have an empty representation are resized
+    // at once, so an absurd size fails right away
+    {
+        std::vector<Empty> v(3);
+        BOOST_HANA_RUNTIME_CHECK(serialized_size(v) == sizeof(unsigned long long));
+        BOOST_HANA_RUNTIME_CHECK(deserialize_from<std::vector<Empty>>(serialize_to_vector(v)).size() == 3);
+
+        auto too_large = [](auto size) {
+            std::vector<char> buffer = bytes_of(size);
+            try {
+                deserialize<std::vector<Empty>>(buffer.data(), buffer.data() + buffer.size());
+            } catch (std::length_error const&) {
+                return true;
+            }
+            return false;
+        };
+        BOOST_HANA_RUNTIME_CHECK(too_large(~0ull));
+        BOOST_HANA_RUNTIME_CHECK(too_large(1ull << 63));
+    }
+}
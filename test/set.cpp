@@ -9,6 +9,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/assert.hpp>
 #include <boost/hana/maybe.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
@@ -20,6 +21,8 @@ using namespace boost::hana;
 
 using test::ct_eq;
 
+struct x0; struct x1; struct x2; struct x3;
+
 int main() {
     auto eqs = make<Tuple>(
         set(),
@@ -160,6 +163,85 @@ int main() {
                 set(ct_eq<1>{}, ct_eq<2>{}, ct_eq<3>{})
             ));
         }
+
+        // Foldable -> Set, with elements that are equal iff they have the
+        // same type
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Set>(foldable(type<x0>, type<x0>)),
+                set(type<x0>)
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Set>(foldable(type<x0>, type<x1>, type<x0>, type<x2>, type<x1>)),
+                set(type<x0>, type<x1>, type<x2>)
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                to<Tuple>(to<Set>(make<Tuple>(type<x0>, type<x1>, type<x0>))),
+                make<Tuple>(type<x1>, type<x0>)
+            ));
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // union_, intersection and difference
+    //////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(), set()),
+            set()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(ct_eq<0>{}, ct_eq<1>{}), set()),
+            set(ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(), set(ct_eq<0>{}, ct_eq<1>{})),
+            set(ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(ct_eq<0>{}, ct_eq<1>{}), set(ct_eq<1>{}, ct_eq<2>{})),
+            set(ct_eq<0>{}, ct_eq<1>{}, ct_eq<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            union_(set(type<x0>, type<x1>), set(type<x2>, type<x1>, type<x3>)),
+            set(type<x0>, type<x1>, type<x2>, type<x3>)
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            intersection(set(), set(ct_eq<0>{})),
+            set()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            intersection(set(ct_eq<0>{}, ct_eq<1>{}), set(ct_eq<2>{})),
+            set()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            intersection(set(ct_eq<0>{}, ct_eq<1>{}), set(ct_eq<1>{}, ct_eq<2>{})),
+            set(ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            intersection(set(type<x0>, type<x1>, type<x2>), set(type<x2>, type<x3>, type<x0>)),
+            set(type<x0>, type<x2>)
+        ));
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            difference(set(), set(ct_eq<0>{})),
+            set()
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            difference(set(ct_eq<0>{}, ct_eq<1>{}), set()),
+            set(ct_eq<0>{}, ct_eq<1>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            difference(set(ct_eq<0>{}, ct_eq<1>{}), set(ct_eq<1>{}, ct_eq<2>{})),
+            set(ct_eq<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            difference(set(type<x0>, type<x1>, type<x2>), set(type<x2>, type<x3>, type<x0>)),
+            set(type<x1>)
+        ));
     }
 
 #elif BOOST_HANA_TEST_PART == 2
@@ -247,6 +329,29 @@ int main() {
             ));
         }
 
+        // find and elem with elements found by their type
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find(set(type<x0>, type<x1>, type<x2>), type<x1>),
+                just(type<x1>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find(set(type<x0>, type<x1>, type<x2>), type<x3>),
+                nothing
+            ));
+            BOOST_HANA_CONSTANT_CHECK(
+                elem(set(type<x0>, type<x1>, type<x2>), type<x2>)
+            );
+            BOOST_HANA_CONSTANT_CHECK(
+                not_(elem(set(type<x0>, type<x1>, type<x2>), type<x3>))
+            );
+
+            // Elements compared at runtime must still be compared, even
+            // when they have the same type.
+            BOOST_HANA_RUNTIME_CHECK(elem(set(1, '2'), 1));
+            BOOST_HANA_RUNTIME_CHECK(not_(elem(set(1, '2'), 2)));
+        }
+
         // laws
         auto eqs = make<Tuple>(
             set(),
@@ -0,0 +1,296 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/soa_vector.hpp>
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/id.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/product.hpp>
+#include <boost/hana/record_macros.hpp>
+#include <boost/hana/string.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+using namespace boost::hana;
+
+
+namespace ns {
+    struct Intrusive {
+        BOOST_HANA_DEFINE_RECORD_INTRUSIVE(Intrusive,
+            (std::string, name),
+            (double, price),
+            (bool, flag)
+        );
+    };
+
+    struct AdHoc {
+        int x;
+        std::string y;
+    };
+
+    struct move_only {
+        int value;
+        move_only() = default;
+        explicit move_only(int v) : value(v) { }
+        move_only(move_only&&) = default;
+        move_only& operator=(move_only&&) = default;
+        move_only(move_only const&) = delete;
+    };
+
+    struct Movable {
+        move_only m;
+        std::string s;
+    };
+}
+
+BOOST_HANA_DEFINE_RECORD(ns::AdHoc,
+    (int, x),
+    (std::string, y)
+);
+
+BOOST_HANA_DEFINE_RECORD(ns::Movable,
+    (ns::move_only, m),
+    (std::string, s)
+);
+
+namespace ns {
+    struct copy_error { };
+
+    // Copying a `throws_on_copy` holding a negative value throws.
+    struct throws_on_copy {
+        int value;
+        throws_on_copy() = default;
+        explicit throws_on_copy(int v) : value(v) { }
+        throws_on_copy(throws_on_copy&&) = default;
+        throws_on_copy& operator=(throws_on_copy&&) = default;
+        throws_on_copy& operator=(throws_on_copy const&) = default;
+        throws_on_copy(throws_on_copy const& other) : value(other.value) {
+            if (value < 0)
+                throw copy_error{};
+        }
+    };
+
+    struct Throwing {
+        int x;
+        throws_on_copy t;
+        std::string s;
+    };
+}
+
+BOOST_HANA_DEFINE_RECORD(ns::Throwing,
+    (int, x),
+    (ns::throws_on_copy, t),
+    (std::string, s)
+);
+
+struct Keyed {
+    int a;
+    double b;
+};
+
+constexpr auto a = decltype_(&Keyed::a);
+constexpr auto b = decltype_(&Keyed::b);
+
+namespace boost { namespace hana {
+    template <>
+    struct members_impl<Keyed> {
+        static BOOST_HANA_CONSTEXPR_LAMBDA auto apply() {
+            return make<Tuple>(
+                make<Pair>(::a, [](auto&& k) -> decltype(auto) {
+                    return id(std::forward<decltype(k)>(k).a);
+                }),
+                make<Pair>(::b, [](auto&& k) -> decltype(auto) {
+                    return id(std::forward<decltype(k)>(k).b);
+                })
+            );
+        }
+    };
+}}
+
+int main() {
+    // columns have the types of the members, in the order of the members
+    {
+        using V = soa_vector<ns::Intrusive>;
+        V v;
+        auto name = BOOST_HANA_STRING("name");
+        auto price = BOOST_HANA_STRING("price");
+        auto flag = BOOST_HANA_STRING("flag");
+        static_assert(std::is_same<
+            decltype(v[name]), std::vector<std::string>&
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(v[price]), std::vector<double>&
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(v[flag]), std::vector<bool>&
+        >{}, "");
+
+        V const& cv = v;
+        static_assert(std::is_same<
+            decltype(cv[price]), std::vector<double> const&
+        >{}, "");
+
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            transform(members<V>(), first),
+            make<Tuple>(BOOST_HANA_STRING("name"), BOOST_HANA_STRING("price"),
+                        BOOST_HANA_STRING("flag"))
+        ));
+    }
+
+    // push_back, size and the columns
+    {
+        soa_vector<ns::Intrusive> v;
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 0);
+
+        ns::Intrusive x{};
+        x.name = "abc"; x.price = 1.5; x.flag = true;
+        v.push_back(x);
+        x.name = "def"; x.price = 2.5; x.flag = false;
+        v.push_back(x);
+
+        BOOST_HANA_RUNTIME_CHECK(!v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v.size() == 2);
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("name")] ==
+                                    std::vector<std::string>{"abc", "def"});
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("price")] ==
+                                    std::vector<double>{1.5, 2.5});
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("flag")] ==
+                                    std::vector<bool>{true, false});
+
+        v.reserve(10);
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("name")].capacity() >= 10);
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("flag")].capacity() >= 10);
+
+        v.clear();
+        BOOST_HANA_RUNTIME_CHECK(v.empty());
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("price")].empty());
+    }
+
+    // proxy references
+    {
+        soa_vector<ns::AdHoc> v;
+        v.push_back(ns::AdHoc{1, "one"});
+        v.push_back(ns::AdHoc{2, "two"});
+
+        // reading and writing members by name
+        BOOST_HANA_RUNTIME_CHECK(v[0][BOOST_HANA_STRING("x")] == 1);
+        BOOST_HANA_RUNTIME_CHECK(v[1][BOOST_HANA_STRING("y")] == "two");
+        v[1][BOOST_HANA_STRING("x")] = 20;
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("x")][1] == 20);
+
+        // converting to the record
+        ns::AdHoc x = v[1];
+        BOOST_HANA_RUNTIME_CHECK(x.x == 20 && x.y == "two");
+
+        // assigning a record
+        v[0] = ns::AdHoc{10, "ten"};
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("x")][0] == 10);
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("y")][0] == "ten");
+
+        // assigning a proxy assigns the element, it does not rebind
+        auto r = v[0];
+        r = v[1];
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("x")][0] == 20);
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("y")][0] == "two");
+        v[1][BOOST_HANA_STRING("x")] = 3;
+        BOOST_HANA_RUNTIME_CHECK(r[BOOST_HANA_STRING("x")] == 20);
+
+        // proxies to a const soa_vector are read-only
+        auto const& cv = v;
+        auto x_ = BOOST_HANA_STRING("x");
+        static_assert(std::is_same<decltype(cv[0][x_]), int const&>{}, "");
+        ns::AdHoc y = cv[1];
+        BOOST_HANA_RUNTIME_CHECK(y.x == 3 && y.y == "two");
+    }
+
+    // the members of an rvalue record are moved into the columns
+    {
+        soa_vector<ns::Movable> v;
+        v.push_back(ns::Movable{ns::move_only{1}, "one"});
+        v[0] = ns::Movable{ns::move_only{2}, "two"};
+        BOOST_HANA_RUNTIME_CHECK(v[0][BOOST_HANA_STRING("m")].value == 2);
+        BOOST_HANA_RUNTIME_CHECK(v[BOOST_HANA_STRING("s")][0] == "two");
+    }
+
+    // push_back leaves the columns unchanged when a member throws
+    {
+        soa_vector<ns::Throwing> v;
+        auto x = BOOST_HANA_STRING("x");
+        auto t = BOOST_HANA_STRING("t");
+        auto s = BOOST_HANA_STRING("s");
+        ns::Throwing good{1, ns::throws_on_copy{1}, "one"};
+        ns::Throwing bad{2, ns::throws_on_copy{-2}, "two"};
+
+        for (int i = 0; i != 3; ++i) {
+            v.push_back(good);
+
+            bool thrown = false;
+            try { v.push_back(bad); }
+            catch (ns::copy_error const&) { thrown = true; }
+            BOOST_HANA_RUNTIME_CHECK(thrown);
+
+            std::size_t const n = static_cast<std::size_t>(i) + 1;
+            BOOST_HANA_RUNTIME_CHECK(v.size() == n);
+            BOOST_HANA_RUNTIME_CHECK(v[x] == std::vector<int>(n, 1));
+            BOOST_HANA_RUNTIME_CHECK(v[t].size() == n);
+            BOOST_HANA_RUNTIME_CHECK(v[s] == std::vector<std::string>(n, "one"));
+        }
+        BOOST_HANA_RUNTIME_CHECK(v[2][t].value == 1);
+    }
+
+    // records whose member names are Types
+    {
+        soa_vector<Keyed> v;
+        v.push_back(Keyed{1, 1.5});
+        BOOST_HANA_RUNTIME_CHECK(v[a] == std::vector<int>{1});
+        BOOST_HANA_RUNTIME_CHECK(v[0][b] == 1.5);
+    }
+
+    // Record
+    {
+        using V = soa_vector<ns::AdHoc>;
+        static_assert(_models<Record, V>{}, "");
+
+        V v;
+        v.push_back(ns::AdHoc{1, "one"});
+        v.push_back(ns::AdHoc{2, "two"});
+
+        int visited = 0;
+        for_each(v, [&](auto const& column) {
+            BOOST_HANA_RUNTIME_CHECK(column.size() == 2);
+            ++visited;
+        });
+        BOOST_HANA_RUNTIME_CHECK(visited == 2);
+
+        // the columns are not copied
+        std::vector<void const*> addresses;
+        for_each(v, [&](auto const& column) { addresses.push_back(&column); });
+        BOOST_HANA_RUNTIME_CHECK(addresses == std::vector<void const*>{
+            &v[BOOST_HANA_STRING("x")], &v[BOOST_HANA_STRING("y")]
+        });
+
+        BOOST_HANA_RUNTIME_CHECK(
+            unpack(v, [](std::vector<int> const& x, std::vector<std::string> const& y) {
+                return x == std::vector<int>{1, 2} &&
+                       y == std::vector<std::string>{"one", "two"};
+            })
+        );
+
+        V w = v;
+        BOOST_HANA_RUNTIME_CHECK(equal(v, w));
+        w[0][BOOST_HANA_STRING("x")] = 3;
+        BOOST_HANA_RUNTIME_CHECK(not_equal(v, w));
+    }
+}
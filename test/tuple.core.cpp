@@ -0,0 +1,99 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/tuple/core.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+
+
+// The container does not depend on the rest of the concepts.
+#if defined(BOOST_HANA_FOLDABLE_HPP) || defined(BOOST_HANA_ITERABLE_HPP)  || \
+    defined(BOOST_HANA_ORDERABLE_HPP) || defined(BOOST_HANA_SEARCHABLE_HPP) || \
+    defined(BOOST_HANA_SEQUENCE_HPP) || defined(BOOST_HANA_TUPLE_HPP)
+#   error "boost/hana/tuple/core.hpp includes more than the Tuple container"
+#endif
+
+struct move_only {
+    int value;
+    move_only(int v) : value(v) { }
+    move_only(move_only&&) = default;
+    move_only(move_only const&) = delete;
+};
+
+int main() {
+    // make and at
+    {
+        BOOST_HANA_CONSTEXPR_CHECK(at(int_<0>, make<Tuple>(1, '2', 3.5)) == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(at(int_<1>, make<Tuple>(1, '2', 3.5)) == '2');
+        BOOST_HANA_CONSTEXPR_CHECK(at(int_<2>, make<Tuple>(1, '2', 3.5)) == 3.5);
+        BOOST_HANA_CONSTEXPR_CHECK(make<Tuple>(1, '2', 3.5)[int_<1>] == '2');
+
+        auto xs = make<Tuple>(std::string{"abc"}, 1);
+        at(int_<1>, xs) = 2;
+        BOOST_HANA_RUNTIME_CHECK(at(int_<0>, xs) == "abc");
+        BOOST_HANA_RUNTIME_CHECK(xs[int_<1>] == 2);
+
+        auto ys = make<Tuple>(1, 2, 3);
+        BOOST_HANA_RUNTIME_CHECK(ys[2] == 3);
+
+        static_assert(std::is_same<
+            decltype(make<Tuple>(1, '2')), _tuple<int, char>
+        >{}, "");
+    }
+
+    // head, tail and is_empty
+    {
+        BOOST_HANA_CONSTEXPR_CHECK(head(make<Tuple>(1, '2', 3.5)) == 1);
+        BOOST_HANA_CONSTEXPR_CHECK(at(int_<1>, tail(make<Tuple>(1, '2', 3.5))) == 3.5);
+        static_assert(std::is_same<
+            decltype(tail(make<Tuple>(1, '2', 3.5))), _tuple<char, double>
+        >{}, "");
+
+        BOOST_HANA_CONSTANT_CHECK(is_empty(make<Tuple>()));
+        BOOST_HANA_CONSTANT_CHECK(!is_empty(make<Tuple>(1)));
+    }
+
+    // unpack
+    {
+        auto sum = [](auto ...x) {
+            int result = 0;
+            using swallow = int[];
+            (void)swallow{0, (result += x)...};
+            return result;
+        };
+        BOOST_HANA_RUNTIME_CHECK(unpack(make<Tuple>(), sum) == 0);
+        BOOST_HANA_RUNTIME_CHECK(unpack(make<Tuple>(1, 2, 3), sum) == 6);
+
+        auto f = [](move_only x, move_only y) { return x.value + y.value; };
+        BOOST_HANA_RUNTIME_CHECK(
+            unpack(make<Tuple>(move_only{1}, move_only{2}), f) == 3
+        );
+    }
+
+    // tuple_c
+    {
+        BOOST_HANA_CONSTANT_CHECK(at(int_<1>, tuple_c<int, 0, 1, 2>) == int_<1>);
+    }
+
+    // visit_at
+    {
+        auto xs = make<Tuple>(0, std::string{"1"});
+        std::string visited;
+        auto f = [&](auto const& x) {
+            using X = typename std::decay<decltype(x)>::type;
+            if (std::is_same<X, int>{}) visited += "int";
+            if (std::is_same<X, std::string>{}) visited += "string";
+        };
+        BOOST_HANA_RUNTIME_CHECK(visit_at(1, xs, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == "string");
+        BOOST_HANA_RUNTIME_CHECK(!visit_at(2, xs, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == "string");
+    }
+}
@@ -186,6 +186,70 @@ int main() {
         test::TestOrderable<Tuple>{ord_tuples};
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // Monoid, Group and Ring (element-wise)
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // runtime elements
+        BOOST_HANA_CONSTEXPR_CHECK(
+            plus(make<Tuple>(1, 2.5, 3l), make<Tuple>(10, 0.5, 30l))
+                == make<Tuple>(11, 3.0, 33l)
+        );
+        BOOST_HANA_CONSTEXPR_CHECK(
+            minus(make<Tuple>(10, 2.5), make<Tuple>(1, 0.5)) == make<Tuple>(9, 2.0)
+        );
+        BOOST_HANA_CONSTEXPR_CHECK(
+            mult(make<Tuple>(2, 2.5), make<Tuple>(3, 2.0)) == make<Tuple>(6, 5.0)
+        );
+        BOOST_HANA_CONSTEXPR_CHECK(
+            negate(make<Tuple>(1, -2.5)) == make<Tuple>(-1, 2.5)
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            plus(make<Tuple>(std::string{"a"}, 1), make<Tuple>(std::string{"b"}, 2))
+                == make<Tuple>(std::string{"ab"}, 3)
+        );
+
+        // Constants are combined at compile-time
+        BOOST_HANA_CONSTANT_CHECK(
+            plus(tuple_c<int, 1, 2, 3>, tuple_c<int, 10, 20, 30>)
+                == tuple_c<int, 11, 22, 33>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            minus(tuple_c<int, 10, 20>, tuple_c<int, 1, 2>) == tuple_c<int, 9, 18>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            mult(tuple_c<int, 2, 3>, tuple_c<int, 4, 5>) == tuple_c<int, 8, 15>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            negate(tuple_c<int, 1, -2>) == tuple_c<int, -1, 2>
+        );
+
+        // mixing Constants and runtime values
+        BOOST_HANA_CONSTEXPR_CHECK(
+            plus(make<Tuple>(int_<1>, 2), make<Tuple>(int_<3>, 4))
+                == make<Tuple>(int_<4>, 6)
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            at_c<0>(plus(make<Tuple>(int_<1>, 2), make<Tuple>(int_<3>, 4))) == int_<4>
+        );
+
+        // empty tuples
+        BOOST_HANA_CONSTANT_CHECK(plus(make<Tuple>(), make<Tuple>()) == make<Tuple>());
+        BOOST_HANA_CONSTANT_CHECK(negate(make<Tuple>()) == make<Tuple>());
+
+        // operators
+        BOOST_HANA_CONSTANT_CHECK(
+            tuple_c<int, 1, 2> + tuple_c<int, 3, 4> == tuple_c<int, 4, 6>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            tuple_c<int, 3, 4> - tuple_c<int, 1, 2> == tuple_c<int, 2, 2>
+        );
+        BOOST_HANA_CONSTANT_CHECK(
+            tuple_c<int, 1, 2> * tuple_c<int, 3, 4> == tuple_c<int, 3, 8>
+        );
+        BOOST_HANA_CONSTANT_CHECK(-tuple_c<int, 1, 2> == tuple_c<int, -1, -2>);
+    }
+
 #elif BOOST_HANA_TEST_PART == 3
     //////////////////////////////////////////////////////////////////////////
     // Foldable
@@ -236,6 +300,27 @@ int main() {
             ));
         }
 
+        // count_if with a Constant predicate on runtime values
+        {
+            auto is_int = [](auto const& x) {
+                return bool_<std::is_same<decltype(x), int const&>{}>;
+            };
+            auto xs = make<Tuple>(1, '2', 3, std::string{"4"});
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(xs, is_int),
+                boost::hana::size_t<2>
+            ));
+
+            // the predicate may take its argument by non-const reference
+            auto is_char = [](auto& x) {
+                return bool_<std::is_same<decltype(x), char&>{}>;
+            };
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(xs, is_char),
+                boost::hana::size_t<1>
+            ));
+        }
+
         test::TestFoldable<Tuple>{eq_tuples};
     }
 
@@ -319,6 +404,24 @@ int main() {
             , make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}, eq<3>{}, eq<4>{})
         );
 
+        // find_if with a Constant predicate on runtime values
+        {
+            auto is_char = [](auto const& x) {
+                return bool_<std::is_same<decltype(x), char const&>{}>;
+            };
+            auto xs = make<Tuple>(1, '2', 3, '4');
+            BOOST_HANA_RUNTIME_CHECK(find_if(xs, is_char) == just('2'));
+            BOOST_HANA_CONSTANT_CHECK(
+                find_if(make<Tuple>(1, 3), is_char) == nothing
+            );
+
+            // the predicate may take its argument by non-const reference
+            auto is_int = [](auto& x) {
+                return bool_<std::is_same<decltype(x), int&>{}>;
+            };
+            BOOST_HANA_RUNTIME_CHECK(find_if(xs, is_int) == just(1));
+        }
+
         auto eq_tuple_keys = make<Tuple>(eq<3>{}, eq<5>{});
         test::TestSearchable<Tuple>{eq_tuples, eq_tuple_keys};
     }
@@ -328,6 +431,70 @@ int main() {
     // Sequence
     //////////////////////////////////////////////////////////////////////////
     {
+        // sort and sort_by with Constants
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort(make<Tuple>(int_<2>, int_<0>, int_<1>, int_<0>)),
+                make<Tuple>(int_<0>, int_<0>, int_<1>, int_<2>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort(make<Tuple>(int_<3>, long_<1>, ullong<2>, char_<0>)),
+                make<Tuple>(char_<0>, long_<1>, ullong<2>, int_<3>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort(tuple_c<long, 3, 1, 2>),
+                tuple_c<long, 1, 2, 3>
+            ));
+
+            auto by_size = [](auto x, auto y) {
+                return bool_<(sizeof(typename decltype(x)::type) <
+                              sizeof(typename decltype(y)::type))>;
+            };
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort_by(by_size, tuple_t<char[4], char[2], char[3], char[1]>),
+                tuple_t<char[1], char[2], char[3], char[4]>
+            ));
+
+            // stability
+            auto by_head = [](auto x, auto y) {
+                return less(head(x), head(y));
+            };
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort_by(by_head, make<Tuple>(
+                    make<Tuple>(int_<1>, eq<0>{}), make<Tuple>(int_<0>, eq<1>{}),
+                    make<Tuple>(int_<1>, eq<2>{}), make<Tuple>(int_<0>, eq<3>{})
+                )),
+                make<Tuple>(
+                    make<Tuple>(int_<0>, eq<1>{}), make<Tuple>(int_<0>, eq<3>{}),
+                    make<Tuple>(int_<1>, eq<0>{}), make<Tuple>(int_<1>, eq<2>{})
+                )
+            ));
+
+            // predicates taking their arguments by non-const reference
+            auto by_value = [](auto& x, auto& y) { return less(x, y); };
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort_by(by_value, make<Tuple>(int_<2>, int_<0>, int_<1>)),
+                make<Tuple>(int_<0>, int_<1>, int_<2>)
+            ));
+        }
+
+        // partition and filter with a Constant predicate on runtime values
+        {
+            auto is_int = [](auto const& x) {
+                return bool_<std::is_same<decltype(x), int const&>{}>;
+            };
+            auto xs = make<Tuple>(1, '2', 3, std::string{"4"});
+
+            BOOST_HANA_RUNTIME_CHECK(equal(
+                filter(xs, is_int),
+                make<Tuple>(1, 3)
+            ));
+            BOOST_HANA_RUNTIME_CHECK(equal(
+                partition(xs, is_int),
+                pair(make<Tuple>(1, 3), make<Tuple>('2', std::string{"4"}))
+            ));
+        }
+
         test::TestSequence<Tuple>{};
     }
 
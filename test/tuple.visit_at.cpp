@@ -0,0 +1,126 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <test/cnumeric.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace boost::hana;
+
+
+struct move_only {
+    int value;
+    move_only(int v) : value(v) { }
+    move_only(move_only&&) = default;
+    move_only(move_only const&) = delete;
+};
+
+int main() {
+    // visit_at on an empty tuple
+    {
+        auto f = [](auto) { BOOST_HANA_RUNTIME_CHECK(false); };
+        BOOST_HANA_RUNTIME_CHECK(!visit_at(0, make<Tuple>(), f));
+        BOOST_HANA_RUNTIME_CHECK(!visit_at(1, make<Tuple>(), f));
+    }
+
+    // visit_at calls the function on the right element, and only on valid
+    // indices
+    {
+        auto xs = make<Tuple>(0, '1', std::string{"2"}, 3.5);
+        std::string visited;
+        auto f = [&](auto const& x) {
+            using X = typename std::decay<decltype(x)>::type;
+            if (std::is_same<X, int>{}) visited += "int";
+            if (std::is_same<X, char>{}) visited += "char";
+            if (std::is_same<X, std::string>{}) visited += "string";
+            if (std::is_same<X, double>{}) visited += "double";
+        };
+
+        for (std::size_t i = 0; i != 4; ++i)
+            BOOST_HANA_RUNTIME_CHECK(visit_at(i, xs, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == "intcharstringdouble");
+
+        visited.clear();
+        BOOST_HANA_RUNTIME_CHECK(!visit_at(4, xs, f));
+        BOOST_HANA_RUNTIME_CHECK(!visit_at(std::size_t(-1), xs, f));
+        BOOST_HANA_RUNTIME_CHECK(visited.empty());
+    }
+
+    // visit_at preserves the value category of the tuple
+    {
+        auto xs = make<Tuple>(1, 2);
+        BOOST_HANA_RUNTIME_CHECK(visit_at(1, xs, [](auto& x) { x = 20; }));
+        BOOST_HANA_RUNTIME_CHECK(xs == make<Tuple>(1, 20));
+
+        auto const& cxs = xs;
+        BOOST_HANA_RUNTIME_CHECK(visit_at(0, cxs, [](auto& x) {
+            static_assert(std::is_const<
+                typename std::remove_reference<decltype(x)>::type
+            >{}, "");
+        }));
+
+        _tuple<move_only, move_only> ys{move_only{1}, move_only{2}};
+        int stolen = 0;
+        BOOST_HANA_RUNTIME_CHECK(visit_at(1, std::move(ys), [&](auto&& x) {
+            static_assert(std::is_rvalue_reference<decltype(x)>{}, "");
+            move_only m{std::move(x)};
+            stolen = m.value;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(stolen == 2);
+    }
+
+    // visit_at works on Iterables other than Tuple
+    {
+        int visited = -1;
+        auto f = [&](auto x) { visited = value(x); };
+        BOOST_HANA_RUNTIME_CHECK(visit_at(3, range_c<int, 5, 10>, f));
+        BOOST_HANA_RUNTIME_CHECK(visited == 8);
+        BOOST_HANA_RUNTIME_CHECK(!visit_at(5, range_c<int, 5, 10>, f));
+        BOOST_HANA_RUNTIME_CHECK(!visit_at(0, range_c<int, 0, 0>, f));
+
+        BOOST_HANA_RUNTIME_CHECK(visit_at(1, make<Tuple>(
+            test::cnumeric<int, 0>, test::cnumeric<int, 1>
+        ), [&](auto x) { visited = value(x); }));
+        BOOST_HANA_RUNTIME_CHECK(visited == 1);
+    }
+
+    // operator[] with a built-in integer
+    {
+        auto xs = make<Tuple>(0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+        for (int i = 0; i != 10; ++i)
+            BOOST_HANA_RUNTIME_CHECK(xs[i] == i);
+
+        for (unsigned char i = 0; i != 10; ++i)
+            xs[i] *= 2;
+        BOOST_HANA_RUNTIME_CHECK(
+            xs == make<Tuple>(0, 2, 4, 6, 8, 10, 12, 14, 16, 18)
+        );
+
+        auto const& cxs = xs;
+        static_assert(std::is_same<decltype(cxs[1]), int const&>{}, "");
+        static_assert(std::is_same<decltype(xs[1]), int&>{}, "");
+        static_assert(std::is_same<decltype(std::move(xs)[1]), int&&>{}, "");
+
+        // Constant indices still go through `at`.
+        auto ys = make<Tuple>(0, '1', 2.0);
+        BOOST_HANA_RUNTIME_CHECK(ys[int_<1>] == '1');
+    }
+
+    // operator[] with a built-in integer reaches every valid index; invalid
+    // indices must be checked beforehand, e.g. with visit_at
+    {
+        auto xs = make<Tuple>(0, 1, 2);
+        for (int i = 0; i != 3; ++i)
+            BOOST_HANA_RUNTIME_CHECK(xs[i] == i);
+        BOOST_HANA_RUNTIME_CHECK(xs[2u] == 2);
+        BOOST_HANA_RUNTIME_CHECK(xs[static_cast<signed char>(1)] == 1);
+    }
+}
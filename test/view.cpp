@@ -0,0 +1,177 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/functional/compose.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/view.hpp>
+
+#include <type_traits>
+using namespace boost::hana;
+
+
+int copies = 0;
+
+template <int i>
+struct counted {
+    int value;
+    explicit counted(int v) : value(v) { }
+    counted(counted const& other) : value(other.value) { ++copies; }
+    counted(counted&& other) : value(other.value) { ++copies; }
+};
+
+template <int i, int j>
+bool operator==(counted<i> const& a, counted<j> const& b)
+{ return i == j && a.value == b.value; }
+
+template <int i, int j>
+bool operator!=(counted<i> const& a, counted<j> const& b)
+{ return !(a == b); }
+
+struct is_even_index {
+    template <int i>
+    constexpr auto operator()(counted<i> const&) const
+    { return bool_<i % 2 == 0>; }
+};
+
+int main() {
+    // Views refer to the elements of the tuple
+    {
+        auto xs = make<Tuple>(1, 2, 3);
+        auto v = reversed(xs);
+        static_assert(std::is_same<decltype(head(v)), int&>{}, "");
+        head(v) = 30;
+        BOOST_HANA_RUNTIME_CHECK(xs == make<Tuple>(1, 2, 30));
+
+        auto const& cxs = xs;
+        static_assert(std::is_same<decltype(head(reversed(cxs))), int const&>{}, "");
+    }
+
+    // Iterable
+    {
+        auto xs = make<Tuple>(0, '1', 2.0, 3u);
+        auto v = sliced(xs, int_<1>, int_<4>);
+        BOOST_HANA_CONSTANT_CHECK(not_(is_empty(v)));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(drop(int_<3>, v)));
+        BOOST_HANA_CONSTANT_CHECK(is_empty(drop(int_<10>, v)));
+        BOOST_HANA_RUNTIME_CHECK(head(v) == '1');
+        BOOST_HANA_RUNTIME_CHECK(head(tail(v)) == 2.0);
+        BOOST_HANA_RUNTIME_CHECK(last(v) == 3u);
+        BOOST_HANA_RUNTIME_CHECK(at_c<1>(v) == 2.0);
+        BOOST_HANA_RUNTIME_CHECK(v[int_<2>] == 3u);
+        BOOST_HANA_RUNTIME_CHECK(head(drop(int_<2>, v)) == 3u);
+
+        // Repeatedly taking the tail of a slice does not nest views.
+        static_assert(std::is_same<
+            decltype(tail(tail(v))), decltype(sliced(xs, int_<3>, int_<4>))
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(reversed(reversed(xs))), decltype(filtered(xs, always(true_)))
+        >{}, "");
+    }
+
+    // Subranges of a tuple are only an offset into the tuple
+    {
+        auto xs = make<Tuple>(0, '1', 2.0, 3u);
+        auto v = viewed(xs);
+        static_assert(std::is_same<decltype(viewed(v)), decltype(v)>{}, "");
+        static_assert(std::is_same<
+            decltype(v), decltype(sliced(xs, int_<0>, int_<4>))
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(drop(int_<2>, tail(v))), decltype(sliced(xs, int_<3>, int_<4>))
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(second(uncons(v))), decltype(tail(v))
+        >{}, "");
+        static_assert(std::is_same<decltype(first(uncons(v))), int&>{}, "");
+        static_assert(sizeof(tail(tail(v))) == sizeof(&xs), "");
+
+        BOOST_HANA_RUNTIME_CHECK(head(tail(tail(v))) == 2.0);
+        BOOST_HANA_RUNTIME_CHECK(head(drop(int_<3>, v)) == 3u);
+        BOOST_HANA_CONSTANT_CHECK(is_empty(drop(int_<3>, tail(v))));
+        BOOST_HANA_RUNTIME_CHECK(to<Tuple>(tail(v)) == make<Tuple>('1', 2.0, 3u));
+    }
+
+    // Foldable
+    {
+        auto xs = make<Tuple>(1, 2, 3, 4);
+        auto v = joined(xs, transformed(xs, [](int x) { return x * 10; }));
+        BOOST_HANA_CONSTANT_CHECK(length(v) == size_t<8>);
+        BOOST_HANA_RUNTIME_CHECK(foldl(v, 0, [](int s, int x) { return s + x; }) == 110);
+        BOOST_HANA_RUNTIME_CHECK(
+            unpack(v, make<Tuple>) == make<Tuple>(1, 2, 3, 4, 10, 20, 30, 40)
+        );
+        BOOST_HANA_CONSTANT_CHECK(length(joined(sliced(xs, int_<0>, int_<0>),
+                                                sliced(xs, int_<4>, int_<4>)))
+                                  == size_t<0>);
+    }
+
+    // Searchable
+    {
+        auto xs = make<Tuple>(1, 2.0, '3');
+        auto is_char = [](auto x) {
+            return bool_<std::is_same<decltype(x), char>{}>;
+        };
+        BOOST_HANA_RUNTIME_CHECK(find_if(reversed(xs), is_char) == just('3'));
+        BOOST_HANA_CONSTANT_CHECK(find_if(filtered(xs, compose(not_, is_char)), is_char) == nothing);
+        BOOST_HANA_CONSTANT_CHECK(any_of(joined(xs, xs), is_char));
+    }
+
+    // Elements are only copied when the view is converted to a Tuple
+    {
+        auto xs = make<Tuple>(counted<0>{0}, counted<1>{1}, counted<2>{2},
+                              counted<3>{3}, counted<4>{4}, counted<5>{5});
+        copies = 0;
+
+        auto identity = [](auto const& x) -> auto const& { return x; };
+        auto v = sliced(
+            transformed(
+                filtered(reversed(transformed(xs, identity)), is_even_index{}),
+                identity
+            ),
+            int_<1>, int_<3>
+        );
+        BOOST_HANA_RUNTIME_CHECK(copies == 0);
+        BOOST_HANA_RUNTIME_CHECK(head(v).value == 2);
+        BOOST_HANA_RUNTIME_CHECK(copies == 0);
+
+        auto ys = to<Tuple>(v);
+        BOOST_HANA_RUNTIME_CHECK(copies == 2);
+        BOOST_HANA_RUNTIME_CHECK(ys == make<Tuple>(counted<2>{2}, counted<0>{0}));
+    }
+
+    // The default Iterable methods don't copy the elements of a view
+    {
+        auto xs = make<Tuple>(counted<0>{0}, counted<1>{1}, counted<2>{2},
+                              counted<3>{3}, counted<4>{4}, counted<5>{5});
+        copies = 0;
+
+        auto v = viewed(xs);
+        auto odd = drop_while(v, is_even_index{});
+        static_assert(std::is_same<
+            decltype(odd), decltype(sliced(xs, int_<1>, int_<6>))
+        >{}, "");
+        BOOST_HANA_RUNTIME_CHECK(head(odd).value == 1);
+
+        int sum = Iterable::foldl_impl<View>::apply(v, 0, [](int s, auto const& x) {
+            return s + x.value;
+        });
+        BOOST_HANA_RUNTIME_CHECK(sum == 15);
+
+        int digits = Iterable::foldr1_impl<View>::apply(
+            transformed(v, [](auto const& x) { return x.value; }),
+            [](int x, int s) { return s * 10 + x; }
+        );
+        BOOST_HANA_RUNTIME_CHECK(digits == 543210);
+        BOOST_HANA_RUNTIME_CHECK(copies == 0);
+    }
+}